@@ -1,146 +1,272 @@
 #include <iostream>
 #include <string_view>
 #include <array>
-#include <queue>
+#include <vector>
 #include <charconv>
 #include <numeric>
-#include <unordered_set>
 #include <algorithm>
-#include <bitset>
-
-constexpr int num_floors = 4;
+#include <cstdint>
+#include <cassert>
+#include <bit>
 
 struct Pair {
     int micro_floor;
     int gen_floor;
-    int state_rep() const {
-        return micro_floor*num_floors+gen_floor;
-    }
-    bool operator<(const Pair& o) const {
-        return state_rep() < o.state_rep();
-    }
 };
 
-template<int NPairs>
+/*
+    Pairs are interchangeable, so a state is fully described by how many pairs there are of each (micro,gen) floor combination plus the elevator.
+    The histogram is encoded stars-and-bars style: for every combination a 1 bit per pair followed by a 0 separator.
+    That takes num_pairs + floors^2 - 1 bits, which leaves room for 15 pairs on 6 floors in a single 64-bit key.
+*/
+template<int NFloors>
 struct State {
-    std::array<Pair,NPairs> pairs;
-    int elevator;
-    bool valid() const {
-        std::bitset<num_floors> has_generator;
-        std::bitset<num_floors> unprotected_chip;
+    static constexpr int num_types = NFloors*NFloors;
+    static constexpr int elevator_bits = std::bit_width(unsigned(NFloors-1));
+
+    std::array<uint8_t,num_types> counts{};
+    int elevator = 0;
+
+    static constexpr int type(int micro, int gen) {
+        return micro*NFloors+gen;
+    }
+
+    static State from_pairs(const std::vector<Pair>& pairs, int elevator) {
+        State s;
         for(auto [micro,gen] : pairs) {
-            has_generator.set(gen);
-            if(micro != gen) {
-                unprotected_chip.set(micro);
+            s.counts[type(micro,gen)]++;
+        }
+        s.elevator = elevator;
+        assert(int(pairs.size()) + num_types - 1 + elevator_bits <= 64);
+        return s;
+    }
+
+    int num_pairs() const {
+        return std::accumulate(counts.begin(),counts.end(),0);
+    }
+
+    bool valid() const {
+        unsigned has_generator = 0;
+        unsigned unprotected_chip = 0;
+        for(int micro = 0; micro < NFloors; ++micro) {
+            for(int gen = 0; gen < NFloors; ++gen) {
+                if(not counts[type(micro,gen)]) continue;
+                has_generator |= 1u << gen;
+                if(micro != gen) {
+                    unprotected_chip |= 1u << micro;
+                }
             }
         }
-        return (has_generator & unprotected_chip).none();
+        return (has_generator & unprotected_chip) == 0;
     }
 
-    int state_rep() const {
-        return std::accumulate(pairs.begin(),pairs.end(),0,[](auto acc, Pair p) {return acc*num_floors*num_floors + p.state_rep();})*num_floors + elevator;
+    uint64_t encode() const {
+        uint64_t key = 0;
+        for(int t = 0; t < num_types; ++t) {
+            key = (key << counts[t]) | ((uint64_t(1) << counts[t]) - 1);
+            if(t != num_types-1) key <<= 1;
+        }
+        return (key << elevator_bits) | elevator;
+    }
+
+    static State decode(uint64_t key) {
+        State s;
+        s.elevator = key & ((1u << elevator_bits) - 1);
+        key >>= elevator_bits;
+        for(int t = num_types-1; t >= 0; --t) {
+            int ones = std::countr_one(key);
+            s.counts[t] = ones;
+            key >>= ones+1;
+        }
+        return s;
     }
 
+    bool is_goal() const {
+        return counts[type(NFloors-1,NFloors-1)] == num_pairs() and elevator == NFloors-1;
+    }
+
+    static State goal(int num_pairs) {
+        State s;
+        s.counts[type(NFloors-1,NFloors-1)] = num_pairs;
+        s.elevator = NFloors-1;
+        return s;
+    }
+
+    //Items of the same type and kind are interchangeable, so only one representative of each is moved
     template<typename F>
-    void neighbours(F&& callback) {
-        auto get = [](auto& ps, int num) -> int& {
-            auto& p = ps[num/2];
-            return num % 2 ? p.gen_floor : p.micro_floor;
+    void neighbours(F&& callback) const {
+        struct Item {int type; bool gen;};
+        std::array<Item,2*num_types> items;
+        int num_items = 0;
+        for(int other = 0; other < NFloors; ++other) {
+            if(counts[type(elevator,other)]) items[num_items++] = {type(elevator,other),false};
+            if(counts[type(other,elevator)]) items[num_items++] = {type(other,elevator),true};
+        }
+
+        auto moved = [](int t, bool gen, int level) {
+            return gen ? type(t/NFloors,level) : type(level,t%NFloors);
         };
-        auto next = [&get](auto ps, int num, int level) {
-            get(ps,num) = level;
-            std::sort(ps.begin(),ps.end());
-            return ps;
+
+        auto emit = [&callback](State n) {
+            if(n.valid())
+                callback(n);
         };
 
-        for(int i = 0; i < NPairs*2; ++i) {
-            if(get(pairs,i) != elevator) continue;
-
-            auto inner = [this,&i,&next,&get,&callback](int level) {
-                auto imoved = next(pairs,i,level);
-                if(State{imoved,level}.valid())
-                    callback(State{imoved,level});
-                for(int j = i+1; j < NPairs*2; ++j) {
-                    if(get(pairs,j) != elevator) continue;
-                    auto n = next(imoved,j,level);
-                    if(State{n,level}.valid())
-                        callback(State{n,level});
+        for(int level : {elevator+1,elevator-1}) {
+            if(level < 0 or level >= NFloors) continue;
+            for(int i = 0; i < num_items; ++i) {
+                auto [ti,gi] = items[i];
+                State one = *this;
+                one.elevator = level;
+                one.counts[ti]--;
+                one.counts[moved(ti,gi,level)]++;
+                emit(one);
+
+                for(int j = i; j < num_items; ++j) {
+                    auto [tj,gj] = items[j];
+                    if(ti == tj and gi != gj) {
+                        //Both halves of a single pair on the elevator floor
+                        State both = *this;
+                        both.elevator = level;
+                        both.counts[ti]--;
+                        both.counts[type(level,level)]++;
+                        emit(both);
+                    }
+                    if(one.counts[tj] == 0) continue;
+                    State two = one;
+                    two.counts[tj]--;
+                    two.counts[moved(tj,gj,level)]++;
+                    emit(two);
                 }
-            };
-            if(elevator < num_floors-1) {
-                inner(elevator+1);
-            }
-            if(elevator > 0) {
-                inner(elevator-1);
             }
         }
     }
 };
 
 template<int N>
-std::ostream& operator<<(std::ostream& o, State<N> s) {
-    std::cout << s.elevator << ' ';
-    for(auto p : s.pairs) {
-        std::cout << "(m" << p.micro_floor << " g" << p.gen_floor << ") ";
+std::ostream& operator<<(std::ostream& o, const State<N>& s) {
+    o << s.elevator << ' ';
+    for(int t = 0; t < State<N>::num_types; ++t) {
+        for(int i = 0; i < s.counts[t]; ++i) {
+            o << "(m" << t/N << " g" << t%N << ") ";
+        }
     }
     return o;
 }
 
-constexpr int num_pairs = 5;
+//Linear probing set of 64-bit keys with a BFS depth per key, ~0 marks an empty slot
+class VisitedTable {
+    static constexpr uint64_t empty = ~uint64_t(0);
+    std::vector<uint64_t> keys;
+    std::vector<uint16_t> depths;
+    size_t used = 0;
 
-State<num_pairs> parse(std::string_view input) {
-    //Thulium and cobalt have both on the first floor, and polonium and promethium are split between floor 1 and 2(microchip being on floor 2)
-    return {{{{0,0},{0,0},{0,0},{1,0},{1,0}}},0};
-    //return {{{{0,1},{0,2}}},0};
-}
+    size_t slot(uint64_t key) const {
+        return (key * 0x9E3779B97F4A7C15ull) >> (64 - std::countr_zero(keys.size()));
+    }
 
-auto part2_input(State<num_pairs> s) {
-    State<num_pairs+2> ret;
+    void grow() {
+        auto old_keys = std::move(keys);
+        auto old_depths = std::move(depths);
+        keys.assign(old_keys.size()*2,empty);
+        depths.assign(old_keys.size()*2,0);
+        used = 0;
+        for(size_t i = 0; i < old_keys.size(); ++i) {
+            if(old_keys[i] != empty) insert(old_keys[i],old_depths[i]);
+        }
+    }
+
+public:
+    VisitedTable(): keys(1 << 12,empty), depths(1 << 12) {}
 
-    ret.pairs[0] = ret.pairs[1] = {0,0};
+    //Returns false if the key was already present
+    bool insert(uint64_t key, uint16_t depth) {
+        if(2*(used+1) > keys.size()) grow();
+        size_t mask = keys.size()-1;
+        for(size_t i = slot(key);; i = (i+1) & mask) {
+            if(keys[i] == key) return false;
+            if(keys[i] == empty) {
+                keys[i] = key;
+                depths[i] = depth;
+                ++used;
+                return true;
+            }
+        }
+    }
 
-    for(int i = 0; i < num_pairs; ++i) {
-        ret.pairs[i+2] = s.pairs[i];
+    //Returns -1 if the key is not present
+    int find(uint64_t key) const {
+        size_t mask = keys.size()-1;
+        for(size_t i = slot(key);; i = (i+1) & mask) {
+            if(keys[i] == key) return depths[i];
+            if(keys[i] == empty) return -1;
+        }
     }
+};
 
-    ret.elevator = 0;
+constexpr int num_floors = 4;
 
-    return ret;
+std::vector<Pair> parse(std::string_view input) {
+    //Thulium and cobalt have both on the first floor, and polonium and promethium are split between floor 1 and 2(microchip being on floor 2)
+    return {{0,0},{0,0},{0,0},{1,0},{1,0}};
+    //return {{0,1},{0,2}};
 }
 
-template<int N>
-auto search(State<N> start) {
-    auto is_goal = [](const State<N>& s) {
-        return std::all_of(s.pairs.begin(),s.pairs.end(),[](auto p) {
-            return p.gen_floor == p.micro_floor and p.micro_floor == num_floors-1;
-        });
+auto part2_input(std::vector<Pair> pairs) {
+    pairs.push_back({0,0});
+    pairs.push_back({0,0});
+    return pairs;
+}
+
+//Every move can be undone, so the goal side is expanded with the same neighbours function
+//Always grows the smaller frontier by one full level and stops at the first level that meets the other side
+template<int NFloors>
+int search(State<NFloors> start) {
+    using S = State<NFloors>;
+    struct Side {
+        VisitedTable seen;
+        std::vector<uint64_t> frontier;
+        int depth = 0;
     };
-    
-    std::unordered_set<int> seen;
-    std::queue<std::pair<int,State<N>>> states;
-    states.push({0,start});
-    seen.insert(start.state_rep());
-
-    while(not states.empty()) {
-        auto [len,current] = states.front();
-        states.pop();
-        if(is_goal(current)) {
-            return len;
+
+    auto goal = S::goal(start.num_pairs());
+    if(start.encode() == goal.encode()) return 0;
+
+    Side forward, backward;
+    forward.frontier.push_back(start.encode());
+    forward.seen.insert(start.encode(),0);
+    backward.frontier.push_back(goal.encode());
+    backward.seen.insert(goal.encode(),0);
+
+    std::vector<uint64_t> next;
+    while(not forward.frontier.empty() and not backward.frontier.empty()) {
+        auto& [seen,frontier,depth] = forward.frontier.size() <= backward.frontier.size() ? forward : backward;
+        auto& other = &seen == &forward.seen ? backward : forward;
+        int best = -1;
+        next.clear();
+        for(auto key : frontier) {
+            S::decode(key).neighbours([&](const S& n) {
+                auto k = n.encode();
+                if(int d = other.seen.find(k); d >= 0 and (best < 0 or depth+1+d < best)) {
+                    best = depth+1+d;
+                }
+                if(seen.insert(k,depth+1)) {
+                    next.push_back(k);
+                }
+            });
         }
-        current.neighbours([&,len=len](State<N> next) {
-            if(seen.insert(next.state_rep()).second) {
-                states.push({len+1,next});
-            }
-        });
+        if(best >= 0) return best;
+        std::swap(frontier,next);
+        ++depth;
     }
 
-    return 0;
+    return -1;
 }
 
 void solution(std::string_view input) {
     auto start = parse(input);
-    std::cout << "Part 1: " << search(start) << '\n';
-    std::cout << "Part 2: " << search(part2_input(start)) << '\n';
+    std::cout << "Part 1: " << search(State<num_floors>::from_pairs(start,0)) << '\n';
+    std::cout << "Part 2: " << search(State<num_floors>::from_pairs(part2_input(start),0)) << '\n';
 }
 
 std::string_view input = R"(The first floor contains a polonium generator, a thulium generator, a thulium-compatible microchip, a promethium generator, a ruthenium generator, a ruthenium-compatible microchip, a cobalt generator, and a cobalt-compatible microchip.
@@ -3,6 +3,12 @@
 #include <charconv>
 #include <vector>
 #include <algorithm>
+#include <array>
+#include <map>
+#include <thread>
+#include <utility>
+#include <bit>
+#include <random>
 
 std::vector<std::string_view> split(std::string_view in, char delim) {
     std::vector<std::string_view> ret;
@@ -37,32 +43,128 @@ auto parse(std::string_view input) {
         ranges.push_back({to_int(l.substr(0,mid)),to_int(l.substr(mid+1))});
     }
 
-    std::sort(ranges.begin(),ranges.end());
-
     return ranges;
 }
 
+//Stable LSD radix sort on start, 8 bits per pass. Every thread histograms its own chunk, then scatters it to offsets that keep chunks in order
+void radix_sort(std::vector<Range>& ranges) {
+    constexpr int digit_bits = 8;
+    constexpr std::size_t buckets = 1 << digit_bits;
+    if(ranges.empty()) return;
+
+    auto max_start = std::max_element(ranges.begin(),ranges.end())->start;
+    int passes = (std::bit_width(max_start) + digit_bits - 1) / digit_bits;
+    std::size_t num_threads = ranges.size() < (1 << 16) ? 1 : std::max(1u,std::thread::hardware_concurrency());
+    std::size_t chunk = (ranges.size() + num_threads - 1) / num_threads;
+
+    std::vector<Range> scratch(ranges.size());
+    std::vector<std::array<std::size_t,buckets>> offsets(num_threads);
+
+    auto parallel = [num_threads](auto&& f) {
+        std::vector<std::thread> threads;
+        for(std::size_t t = 1; t < num_threads; ++t) threads.emplace_back(f,t);
+        f(0);
+        for(auto& t : threads) t.join();
+    };
+
+    for(int pass = 0; pass < passes; ++pass) {
+        int shift = pass*digit_bits;
+        auto digit = [shift](const Range& r) {return (r.start >> shift) & (buckets-1);};
+        auto begin = [&](std::size_t t) {return std::min(t*chunk,ranges.size());};
+
+        parallel([&](std::size_t t) {
+            auto& count = offsets[t];
+            count.fill(0);
+            for(auto i = begin(t); i < begin(t+1); ++i) count[digit(ranges[i])]++;
+        });
+
+        std::size_t total = 0;
+        for(std::size_t d = 0; d < buckets; ++d) {
+            for(auto& count : offsets) {
+                total += std::exchange(count[d],total);
+            }
+        }
+
+        parallel([&](std::size_t t) {
+            auto& pos = offsets[t];
+            for(auto i = begin(t); i < begin(t+1); ++i) scratch[pos[digit(ranges[i])]++] = ranges[i];
+        });
+        std::swap(ranges,scratch);
+    }
+}
+
+/*
+    Disjoint, non-adjacent blocked intervals keyed on start, with the number of blocked addresses kept up to date.
+    Only addresses up to max_value are kept, whatever a range covers past it is cut off.
+    Inserting merges with every interval it touches, so rules can keep arriving without ever re-sorting, and both queries are O(1).
+*/
+class IntervalSet {
+    std::map<std::uint64_t,std::uint64_t> intervals;
+    std::uint64_t covered = 0;
+    std::uint64_t max_value;
+
+public:
+    explicit IntervalSet(std::uint64_t max_value = 4294967295): max_value(max_value) {}
+
+    //Builds the set from ranges sorted on start in a single merging pass
+    static IntervalSet from_sorted(const std::vector<Range>& ranges, std::uint64_t max_value = 4294967295) {
+        IntervalSet set(max_value);
+        if(ranges.empty() or ranges.front().start > max_value) return set;
+        Range current = ranges.front();
+        current.end = std::min(current.end,max_value);
+        auto flush = [&] {
+            set.intervals.emplace_hint(set.intervals.end(),current.start,current.end);
+            set.covered += current.end - current.start + 1;
+        };
+        for(auto r : ranges) {
+            if(r.start > max_value) break;
+            r.end = std::min(r.end,max_value);
+            if(current.end+1 < r.start) {
+                flush();
+                current = r;
+            } else
+                current.end = std::max(current.end,r.end);
+        }
+        flush();
+        return set;
+    }
+
+    void insert(Range r) {
+        if(r.start > std::min(r.end,max_value)) return;
+        r.end = std::min(r.end,max_value);
+        auto it = intervals.upper_bound(r.start);
+        if(it != intervals.begin()) {
+            auto prev = std::prev(it);
+            if(prev->second+1 >= r.start) it = prev;
+        }
+        while(it != intervals.end() and it->first <= r.end+1) {
+            r.start = std::min(r.start,it->first);
+            r.end = std::max(r.end,it->second);
+            covered -= it->second - it->first + 1;
+            it = intervals.erase(it);
+        }
+        intervals.emplace_hint(it,r.start,r.end);
+        covered += r.end - r.start + 1;
+    }
+
+    //Returns max_value+1 if everything is blocked
+    std::uint64_t lowest_allowed() const {
+        if(intervals.empty() or intervals.begin()->first != 0) return 0;
+        return intervals.begin()->second+1;
+    }
+
+    std::uint64_t allowed_count() const {
+        return max_value + 1 - covered;
+    }
+};
+
 void solution(std::string_view input) {
     auto ranges = parse(input);
-    ranges.push_back({4294967296,4294967296});
-    
-    auto part1 = -1;
-    std::uint64_t part2 = 0;
-    
-    if(ranges.front().start != 0) part1 = 0;
-    Range current{0,0};
-    for(auto r : ranges) {
-        if(current.end+1 < r.start) {
-            if(part1 == -1)
-                part1 = current.end+1;
-            part2 += r.start - (current.end+1);
-            current = r;
-        } else
-            current.end = std::max(current.end,r.end);
-    }
+    radix_sort(ranges);
+    auto blocked = IntervalSet::from_sorted(ranges);
 
-    std::cout << "Part 1: " << part1 << '\n';
-    std::cout << "Part 2: " << part2 << '\n';
+    std::cout << "Part 1: " << blocked.lowest_allowed() << '\n';
+    std::cout << "Part 2: " << blocked.allowed_count() << '\n';
 }
 
 std::string_view input = R"(3382920125-3384842620
@@ -1071,6 +1173,41 @@ std::string_view input = R"(3382920125-3384842620
 573558521-576486773
 3077610247-3082214069)";
 
-int main() {
+//Random ranges over a small address space, some of them past its end, inserted one by one and built in one pass from sorted, against a bitmap
+bool check_insert() {
+    constexpr std::uint64_t max_value = 999;
+    std::mt19937 rng(20);
+    bool ok = true;
+    for(int round = 0; round < 1000 and ok; ++round) {
+        std::vector<Range> ranges(rng() % 20);
+        std::vector<bool> blocked(max_value+1);
+        IntervalSet streamed(max_value);
+        for(auto& r : ranges) {
+            r.start = rng() % 1100;
+            r.end = r.start + rng() % 100;
+            for(auto v = r.start; v <= std::min(r.end,max_value); ++v) blocked[v] = true;
+            streamed.insert(r);
+        }
+        std::sort(ranges.begin(),ranges.end());
+        auto batch = IntervalSet::from_sorted(ranges,max_value);
+
+        auto lowest = std::uint64_t(std::find(blocked.begin(),blocked.end(),false) - blocked.begin());
+        auto count = std::uint64_t(std::count(blocked.begin(),blocked.end(),false));
+        for(auto& set : {streamed,batch}) {
+            if(set.lowest_allowed() != lowest or set.allowed_count() != count) {
+                std::cerr << "Round " << round << ": " << set.lowest_allowed() << '/' << set.allowed_count() << " instead of " << lowest << '/' << count << '\n';
+                ok = false;
+            }
+        }
+    }
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    if(argc > 1 and std::string_view(argv[1]) == "--check") {
+        bool ok = check_insert();
+        std::cout << (ok ? "Check passed" : "Check failed") << '\n';
+        return ok ? 0 : 1;
+    }
     solution(input);
 }
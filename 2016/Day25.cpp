@@ -1,127 +1,57 @@
 #include <iostream>
 #include <string_view>
-#include <array>
 #include <map>
-#include <charconv>
-#include <numeric>
+#include <array>
+#include <vector>
 #include <algorithm>
+#include <thread>
+#include <atomic>
+#include <limits>
+#include "assembunny.h"
 
-std::vector<std::string_view> split(std::string_view in, char delim) {
-    std::vector<std::string_view> ret;
-    std::size_t pos = 0;
-    while((pos = in.find(delim)) != std::string_view::npos) {
-        ret.push_back(in.substr(0,pos));
-        in.remove_prefix(pos+1);
-    }
-    ret.push_back(in);
-    return ret;
-}
-
-template<int N>
-auto split_known(std::string_view in, char delim) {
-    std::array<std::string_view,N> ret;
-    std::size_t pos = 0;
-    std::size_t current = 0;
-    while((pos = in.find(delim)) != std::string_view::npos) {
-        ret[current++] = in.substr(0,pos);
-        in.remove_prefix(pos+1);
-    }
-    ret[current++] = in;
-    return ret;
-}
-
-int to_int(std::string_view s) {
-    int ret;
-    std::from_chars(s.begin(),s.end(),ret);
-    return ret;
-}
-
-struct Arg {
-    int val;
-    bool is_reg;
-};
-
-Arg parse_arg(std::string_view s) {
-    if(s.size() == 1 and s[0] >= 'a' and s[0] <= 'd') {
-        return {s[0]-'a',true};
-    } else {
-        return {to_int(s),false};
+/*
+    The state right after an out(registers + pc) determines everything the program does afterwards, so once such a state repeats the output is periodic.
+    A candidate is accepted when the outputs so far alternate and a state repeats after an even number of outputs, which proves the signal alternates forever.
+    Halting, a wrong output, an odd period or no repeat within max_outputs reject the candidate.
+*/
+bool is_clock(const Assembunny::Program& p, std::int64_t a, int max_outputs = 1 << 16) {
+    Assembunny::Machine m(p);
+    m.regs[0] = a;
+    std::map<std::array<std::int64_t,5>,int> seen;
+    for(int i = 0; i < max_outputs; ++i) {
+        auto out = m.run();
+        if(not out or *out != i % 2) return false;
+        auto [it,inserted] = seen.insert({{m.regs[0],m.regs[1],m.regs[2],m.regs[3],std::int64_t(m.pc)},i});
+        if(not inserted) return (i - it->second) % 2 == 0;
     }
+    return false;
 }
 
-struct Ins {
-    enum {CPY,INC,DEC,JNZ,OUT} type;
-    Arg value;
-    Arg target;
-};
-
-using Program = std::vector<Ins>;
-
-auto parse(std::string_view input) {
-    auto lines = split(input,'\n');
-    Program p;
-    p.reserve(lines.size());
-    for(auto l : lines) {
-        //b is possibly uninitialized but we won't read from it if it is
-        auto [ins,a,b] = split_known<3>(l,' ');
-        switch(ins[0]) {
-            case 'c':
-            case 'j':
-                p.push_back({ins[0] == 'c' ? Ins::CPY : Ins::JNZ, parse_arg(a), parse_arg(b)});
-                break;
-            case 'i':
-            case 'd':
-                p.push_back({ins[0] == 'i' ? Ins::INC : Ins::DEC, parse_arg(a), 1});
-                break;
-            case 'o':
-                p.push_back({Ins::OUT,parse_arg(a),1});
-                break;
-        }
-    }
-    return p;
-}
-
-auto run(const Program& p, std::array<int,4> regs = {0,0,0,0}) {
-    int pc = 0;
-    auto get = [&](Arg a) {return a.is_reg ? regs[a.val] : a.val;};
-
-    while(pc < p.size()) {
-        auto& instr = p[pc];
-        switch(instr.type) {
-            case Ins::CPY:
-                regs[instr.target.val] = get(instr.value);
-                break;
-            case Ins::INC:
-                regs[instr.value.val]++;
-                break;
-            case Ins::DEC:
-                regs[instr.value.val]--;
-                break;
-            case Ins::JNZ:
-                if(get(instr.value) != 0) pc += get(instr.target)-1;
-                break;
-            case Ins::OUT:
-                std::cout << get(instr.value);
+//Candidates are handed out in increasing order, so once every worker has moved past the best accepted value all smaller ones have been rejected
+std::int64_t find_clock(const Assembunny::Program& p) {
+    std::atomic<std::int64_t> next = 1;
+    std::atomic<std::int64_t> best = std::numeric_limits<std::int64_t>::max();
+    auto worker = [&] {
+        for(auto a = next++; a < best; a = next++) {
+            if(is_clock(p,a)) {
+                auto current = best.load();
+                while(a < current and not best.compare_exchange_weak(current,a));
+            }
         }
-        ++pc;
+    };
+    std::vector<std::thread> threads;
+    for(unsigned i = 0; i < std::max(1u,std::thread::hardware_concurrency()); ++i) {
+        threads.emplace_back(worker);
     }
-    std::cout << '\n';
-    return regs[0];
+    for(auto& t : threads) t.join();
+    return best;
 }
 
 void solution(std::string_view input) {
-    auto in = parse(input);
-    auto min = in[1].value.val*in[2].value.val;
-    std::cout << min << '\n';
-    //The output of the main loop is the bit pattern(from least to most significant bit) of min+start input.
-    //Solution is to find the first number with the required bit pattern that's larger than min, and subtract min from it
-    int i = 2;
-    for(; i < min; i = (i << 2)+2);
-    run(in,{i-min});
-    std::cout << i - min << '\n';
+    auto in = Assembunny::parse(input);
+    std::cout << "Part 1: " << find_clock(in) << '\n';
 }
 
-//Removed last jump bc it's what makes the pattern infinite, it basically resets the main loop
 std::string_view input = R"(cpy a d
 cpy 14 c
 cpy 182 b
@@ -150,7 +80,8 @@ dec c
 jnz 1 -4
 jnz 0 0
 out b
-jnz a -19)";
+jnz a -19
+jnz 1 -21)";
 
 int main() {
     solution(input);
@@ -0,0 +1,279 @@
+#pragma once
+#include <string_view>
+#include <array>
+#include <vector>
+#include <optional>
+#include <charconv>
+#include <cstdint>
+
+//Shared assembunny interpreter for Day12, Day23 and Day25
+namespace Assembunny {
+    std::vector<std::string_view> split(std::string_view in, char delim) {
+        std::vector<std::string_view> ret;
+        std::size_t pos = 0;
+        while((pos = in.find(delim)) != std::string_view::npos) {
+            ret.push_back(in.substr(0,pos));
+            in.remove_prefix(pos+1);
+        }
+        ret.push_back(in);
+        return ret;
+    }
+
+    template<int N>
+    auto split_known(std::string_view in, char delim) {
+        std::array<std::string_view,N> ret;
+        std::size_t pos = 0;
+        std::size_t current = 0;
+        while((pos = in.find(delim)) != std::string_view::npos) {
+            ret[current++] = in.substr(0,pos);
+            in.remove_prefix(pos+1);
+        }
+        ret[current++] = in;
+        return ret;
+    }
+
+    int to_int(std::string_view s) {
+        int ret = 0;
+        std::from_chars(s.begin(),s.end(),ret);
+        return ret;
+    }
+
+    struct Arg {
+        int val = 0;
+        bool is_reg = false;
+    };
+
+    Arg parse_arg(std::string_view s) {
+        if(s.size() == 1 and s[0] >= 'a' and s[0] <= 'd') {
+            return {s[0]-'a',true};
+        } else {
+            return {to_int(s),false};
+        }
+    }
+
+    struct Ins {
+        enum {CPY,INC,DEC,JNZ,TGL,OUT} type;
+        Arg value = {};
+        Arg target = {};
+        void toggle() {
+            switch(type) {
+                case INC:
+                    type = DEC;
+                    break;
+                case DEC:
+                case TGL:
+                case OUT:
+                    type = INC;
+                    break;
+                case CPY:
+                    type = JNZ;
+                    break;
+                case JNZ:
+                    type = CPY;
+                    break;
+            }
+        }
+    };
+
+    using Program = std::vector<Ins>;
+
+    Program parse(std::string_view input) {
+        auto lines = split(input,'\n');
+        Program p;
+        p.reserve(lines.size());
+        for(auto l : lines) {
+            //b is possibly uninitialized but we won't read from it if it is
+            auto [ins,a,b] = split_known<3>(l,' ');
+            switch(ins[0]) {
+                case 'c':
+                case 'j':
+                    p.push_back({ins[0] == 'c' ? Ins::CPY : Ins::JNZ, parse_arg(a), parse_arg(b)});
+                    break;
+                case 'i':
+                case 'd':
+                    p.push_back({ins[0] == 'i' ? Ins::INC : Ins::DEC, parse_arg(a)});
+                    break;
+                case 't':
+                    p.push_back({Ins::TGL, parse_arg(a)});
+                    break;
+                case 'o':
+                    p.push_back({Ins::OUT, parse_arg(a)});
+                    break;
+            }
+        }
+        return p;
+    }
+
+    /*
+        Instructions are pre-decoded into ops specialised on their argument kinds, invalid instructions(eg. after a tgl) become NOPs.
+        Two loop shapes are fused into a single op placed on the first instruction of the loop:
+            inc x / dec y / jnz y -2 (either order, or dec x)          x += y, y = 0
+            cpy s y / <add loop on x,y> / dec z / jnz z -5             x += s*z, y = 0, z = 0
+        A fused op only fires when the loop would terminate normally(counters positive), otherwise it falls back to the plain instruction.
+        tgl re-decodes every op whose window can contain the toggled instruction, so a fusion never outlives the code it was built from.
+    */
+    class Machine {
+        public:
+            std::array<std::int64_t,4> regs{};
+            std::size_t pc = 0;
+
+            Machine(Program p) : source(std::move(p)), plain(source.size()), code(source.size()) {
+                for(std::size_t i = 0; i < source.size(); ++i) plain[i] = decode(source[i]);
+                for(std::size_t i = 0; i < source.size(); ++i) code[i] = fuse(i);
+            }
+
+            //Runs until the program halts(returns nullopt) or outputs a value
+            std::optional<std::int64_t> run() {
+                while(pc < code.size()) {
+                    if(auto out = execute(code[pc])) return out;
+                }
+                return std::nullopt;
+            }
+
+            const Program& program() const {
+                return source;
+            }
+
+        private:
+            enum Kind : std::uint8_t {NOP,CPY_R,CPY_I,INC,DEC,JNZ_RR,JNZ_RI,JNZ_IR,JMP,TGL_R,TGL_I,OUT_R,OUT_I,ADD,SUB,MUL};
+            struct Op {
+                Kind kind = NOP;
+                std::int64_t a = 0, b = 0;
+                std::int8_t x = 0, y = 0, z = 0;
+                bool s_is_reg = false;
+            };
+
+            Program source;
+            std::vector<Op> plain;
+            std::vector<Op> code;
+
+            static Op decode(const Ins& ins) {
+                auto [v,t] = std::pair{ins.value,ins.target};
+                switch(ins.type) {
+                    case Ins::CPY:
+                        if(not t.is_reg) return {};
+                        return {v.is_reg ? CPY_R : CPY_I, v.val, t.val};
+                    case Ins::INC:
+                    case Ins::DEC:
+                        if(not v.is_reg) return {};
+                        return {ins.type == Ins::INC ? INC : DEC, v.val};
+                    case Ins::JNZ:
+                        if(not v.is_reg) {
+                            if(v.val == 0) return {};
+                            return t.is_reg ? Op{JNZ_IR, 1, t.val} : Op{JMP, t.val};
+                        }
+                        return {t.is_reg ? JNZ_RR : JNZ_RI, v.val, t.val};
+                    case Ins::TGL:
+                        return {v.is_reg ? TGL_R : TGL_I, v.val};
+                    case Ins::OUT:
+                        return {v.is_reg ? OUT_R : OUT_I, v.val};
+                }
+                return {};
+            }
+
+            //Matches an add loop starting at i, returns {target,counter,sign}
+            std::optional<std::array<int,3>> add_loop(std::size_t i) const {
+                if(i + 3 > plain.size()) return std::nullopt;
+                auto& j = plain[i+2];
+                if(j.kind != JNZ_RI or j.b != -2) return std::nullopt;
+                for(auto [first,second] : {std::pair{i,i+1},std::pair{i+1,i}}) {
+                    auto& mod = plain[first];
+                    auto& counter = plain[second];
+                    if(counter.kind != DEC or counter.a != j.a) continue;
+                    if((mod.kind != INC and mod.kind != DEC) or mod.a == counter.a) continue;
+                    return std::array{int(mod.a),int(counter.a),mod.kind == INC ? 1 : -1};
+                }
+                return std::nullopt;
+            }
+
+            Op fuse(std::size_t i) const {
+                auto& head = plain[i];
+                if(head.kind == CPY_R or head.kind == CPY_I) {
+                    auto inner = add_loop(i+1);
+                    if(inner and i + 6 <= plain.size() and (*inner)[1] == head.b and (*inner)[2] == 1) {
+                        auto [x,y,sign] = *inner;
+                        auto& dec = plain[i+4];
+                        auto& jnz = plain[i+5];
+                        bool source_ok = head.kind == CPY_I or (head.a != x and head.a != y and head.a != dec.a);
+                        if(dec.kind == DEC and jnz.kind == JNZ_RI and jnz.a == dec.a and jnz.b == -5 and dec.a != x and dec.a != y and source_ok) {
+                            Op op{MUL, head.a, 0, std::int8_t(x), std::int8_t(y), std::int8_t(dec.a), head.kind == CPY_R};
+                            return op;
+                        }
+                    }
+                }
+                if(auto loop = add_loop(i)) {
+                    auto [x,y,sign] = *loop;
+                    return {sign > 0 ? ADD : SUB, 0, 0, std::int8_t(x), std::int8_t(y)};
+                }
+                return head;
+            }
+
+            void toggle(std::size_t target) {
+                source[target].toggle();
+                plain[target] = decode(source[target]);
+                std::size_t first = target < 5 ? 0 : target-5;
+                for(std::size_t i = first; i <= target; ++i) code[i] = fuse(i);
+            }
+
+            std::optional<std::int64_t> execute(const Op& op) {
+                switch(op.kind) {
+                    case NOP:
+                        break;
+                    case CPY_R:
+                        regs[op.b] = regs[op.a];
+                        break;
+                    case CPY_I:
+                        regs[op.b] = op.a;
+                        break;
+                    case INC:
+                        regs[op.a]++;
+                        break;
+                    case DEC:
+                        regs[op.a]--;
+                        break;
+                    case JNZ_RR:
+                        if(regs[op.a] != 0) pc += regs[op.b]-1;
+                        break;
+                    case JNZ_RI:
+                        if(regs[op.a] != 0) pc += op.b-1;
+                        break;
+                    case JNZ_IR:
+                        pc += regs[op.b]-1;
+                        break;
+                    case JMP:
+                        pc += op.a-1;
+                        break;
+                    case TGL_R:
+                    case TGL_I: {
+                        auto target = pc + (op.kind == TGL_R ? regs[op.a] : op.a);
+                        if(target < source.size()) toggle(target);
+                        break;
+                    }
+                    case OUT_R:
+                        ++pc;
+                        return regs[op.a];
+                    case OUT_I:
+                        ++pc;
+                        return op.a;
+                    case ADD:
+                    case SUB:
+                        if(regs[op.y] <= 0) return execute(plain[pc]);
+                        regs[op.x] += op.kind == ADD ? regs[op.y] : -regs[op.y];
+                        regs[op.y] = 0;
+                        pc += 3;
+                        return std::nullopt;
+                    case MUL: {
+                        auto s = op.s_is_reg ? regs[op.a] : op.a;
+                        if(s <= 0 or regs[op.z] <= 0) return execute(plain[pc]);
+                        regs[op.x] += s*regs[op.z];
+                        regs[op.y] = 0;
+                        regs[op.z] = 0;
+                        pc += 6;
+                        return std::nullopt;
+                    }
+                }
+                ++pc;
+                return std::nullopt;
+            }
+    };
+}
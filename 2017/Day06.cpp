@@ -1,25 +1,31 @@
 #include <iostream>
 #include <string_view>
 #include <array>
-#include <unordered_map>
+#include <vector>
 #include <charconv>
 #include <numeric>
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <bit>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
-char to_char(std::string_view s) {
-    char ret = 0;
+std::uint64_t to_int(std::string_view s) {
+    std::uint64_t ret = 0;
     std::from_chars(s.begin(),s.end(),ret);
     return ret;
 }
 
 auto split(std::string_view in, char delim) {
-    std::string ret;
+    std::vector<std::uint64_t> ret;
     std::size_t pos = 0;
     while((pos = in.find(delim)) != std::string_view::npos) {
-        ret.push_back(to_char(in.substr(0,pos)));
+        ret.push_back(to_int(in.substr(0,pos)));
         in.remove_prefix(pos+1);
     }
-    ret.push_back(to_char(in));
+    ret.push_back(to_int(in));
     return ret;
 }
 
@@ -27,30 +33,130 @@ auto parse(std::string_view input) {
     return split(input,'\t');
 }
 
-auto next(std::string& in) {
+//Every bank gets the same share, the remainder goes one each to the banks following the emptied one, wrapping around. Branch free so it vectorizes
+template<typename Banks>
+void redistribute(Banks& in) {
     auto m = std::max_element(in.begin(),in.end());
     auto val = *m;
+    std::size_t idx = m - in.begin();
+    std::size_t n = in.size();
     *m = 0;
-    int num_each = val/in.size();
-    int left = val - num_each*in.size();
-    auto current = m+1;
-    while(current != in.end()) {
-        *current++ += (left-- > 0)+num_each;
+    auto num_each = val/n;
+    auto left = val%n;
+    for(std::size_t i = 0; i < n; ++i) {
+        auto dist = i > idx ? i-idx-1 : i+n-idx-1;
+        in[i] += num_each + (dist < left);
     }
-    for(current = in.begin(); current <= m; ++current) {
-        *current += (left-- > 0)+num_each;
+}
+
+//16 banks of up to 255 blocks fill exactly one SSE register
+using Packed = std::array<std::uint8_t,16>;
+
+#ifdef __SSE2__
+void redistribute(Packed& in) {
+    const auto index = _mm_setr_epi8(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15);
+    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in.data()));
+    auto m = _mm_max_epu8(v,_mm_srli_si128(v,8));
+    m = _mm_max_epu8(m,_mm_srli_si128(m,4));
+    m = _mm_max_epu8(m,_mm_srli_si128(m,2));
+    m = _mm_max_epu8(m,_mm_srli_si128(m,1));
+    int val = _mm_cvtsi128_si32(m) & 0xff;
+    int idx = std::countr_zero(unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(v,_mm_set1_epi8(char(val))))));
+
+    v = _mm_andnot_si128(_mm_cmpeq_epi8(index,_mm_set1_epi8(char(idx))),v);
+    auto dist = _mm_and_si128(_mm_add_epi8(index,_mm_set1_epi8(char(15-idx))),_mm_set1_epi8(15));
+    auto extra = _mm_cmplt_epi8(dist,_mm_set1_epi8(char(val%16)));
+    v = _mm_add_epi8(v,_mm_sub_epi8(_mm_set1_epi8(char(val/16)),extra));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(in.data()),v);
+}
+#endif
+
+struct Cycle {
+    std::size_t start;
+    std::size_t length;
+};
+
+//Brent's cycle detection, only ever keeps two states around
+template<typename Banks>
+Cycle find_cycle(const Banks& start) {
+    std::size_t power = 1, length = 1;
+    Banks tortoise = start, hare = start;
+    redistribute(hare);
+    while(tortoise != hare) {
+        if(power == length) {
+            tortoise = hare;
+            power *= 2;
+            length = 0;
+        }
+        redistribute(hare);
+        ++length;
+    }
+
+    tortoise = hare = start;
+    for(std::size_t i = 0; i < length; ++i) redistribute(hare);
+    std::size_t mu = 0;
+    while(tortoise != hare) {
+        redistribute(tortoise);
+        redistribute(hare);
+        ++mu;
+    }
+    return {mu,length};
+}
+
+//Redistributes only once per state instead of Brent's ~3 times, at the cost of remembering every packed state in a linear probing table
+Cycle find_cycle_table(Packed state) {
+    struct Slot {
+        std::uint64_t lo, hi;
+        std::uint32_t step; //step+1, 0 marks an empty slot
+    };
+    std::vector<Slot> table(1 << 12);
+    std::size_t used = 0;
+
+    auto insert = [&](const Packed& s, std::uint32_t step) -> std::uint32_t {
+        if(2*(used+1) > table.size()) {
+            auto old = std::move(table);
+            table.assign(old.size()*2,{});
+            for(auto& slot : old) {
+                if(not slot.step) continue;
+                auto i = ((slot.lo ^ slot.hi*0x9E3779B97F4A7C15ull)*0xBF58476D1CE4E5B9ull) >> (64 - std::countr_zero(table.size()));
+                while(table[i].step) i = (i+1) & (table.size()-1);
+                table[i] = slot;
+            }
+        }
+        std::uint64_t lo, hi;
+        std::memcpy(&lo,s.data(),8);
+        std::memcpy(&hi,s.data()+8,8);
+        auto i = ((lo ^ hi*0x9E3779B97F4A7C15ull)*0xBF58476D1CE4E5B9ull) >> (64 - std::countr_zero(table.size()));
+        for(;; i = (i+1) & (table.size()-1)) {
+            if(not table[i].step) {
+                table[i] = {lo,hi,step+1};
+                ++used;
+                return 0;
+            }
+            if(table[i].lo == lo and table[i].hi == hi) return table[i].step;
+        }
+    };
+
+    for(std::uint32_t step = 0;; ++step) {
+        if(auto seen = insert(state,step)) {
+            return {seen-1,step-(seen-1)};
+        }
+        redistribute(state);
     }
-    return in;
 }
 
 void solution(std::string_view input) {
     auto in = parse(input);
-    int total = 1;
-    std::unordered_map<std::string,int> seen;
-    seen.insert({in,0});
-    while(seen.insert({next(in),total}).second) ++total;
-    std::cout << "Part 1: " << total << '\n';
-    std::cout << "Part 2: " << total - seen.at(in) << '\n';
+    Cycle c;
+    if(in.size() == 16 and std::accumulate(in.begin(),in.end(),std::uint64_t(0)) < 256) {
+        Packed packed;
+        std::copy(in.begin(),in.end(),packed.begin());
+        c = find_cycle_table(packed);
+    } else {
+        c = find_cycle(in);
+    }
+    std::cout << "Part 1: " << c.start + c.length << '\n';
+    std::cout << "Part 2: " << c.length << '\n';
 }
 
 std::string_view input = R"(4	1	15	12	0	9	9	5	5	8	7	3	14	5	12	3)";
@@ -4,6 +4,8 @@
 #include <iostream>
 #include <numeric>
 #include <algorithm>
+#include <cstdint>
+#include "disjoint_sets.h"
 
 template<typename F>
 void split(std::string_view in, char delim, F&& f) {
@@ -21,57 +23,21 @@ int to_int(std::string_view s) {
     return ret;
 }
 
-struct DisjointSets {
-    struct Set {
-        std::size_t parent;
-        std::size_t size;
-    };
-    std::vector<Set> sets;
-    std::size_t total_sets = 0;
-    std::size_t newSet() {
-        sets.push_back({sets.size(),1});
-        total_sets++;
-        return sets.back().parent;
-    }
-    //Path compression
-    Set findRoot(std::size_t n) {
-        auto root = n;
-        while(root != sets[root].parent) {
-            root = sets[root].parent;
-        }
-        //Set all intermediate node's parent to root
-        while(n != sets[n].parent) {
-            auto p = sets[n].parent;
-            sets[n].parent = root;
-            n = p;
-        }
-        return sets[root];
-    }
-    void merge(std::size_t x, std::size_t y) {
-        auto xRoot = findRoot(x);
-        auto yRoot = findRoot(y);
-        
-        if(xRoot.parent == yRoot.parent) return;
-
-        if(xRoot.size < yRoot.size) std::swap(xRoot,yRoot);
-        sets[yRoot.parent].parent = xRoot.parent;
-        sets[xRoot.parent].size += yRoot.size;
-        total_sets--;
-    }
-};
-
 void solution(std::string_view in) {
-    DisjointSets s;
-    split(in,'\n',[&s](std::string_view line) {
-        auto current = s.newSet();
+    std::vector<std::pair<std::uint32_t,std::uint32_t>> edges;
+    std::uint32_t programs = 0;
+    split(in,'\n',[&](std::string_view line) {
+        auto current = programs++;
         auto del = line.find('>');
         split(line.substr(del+1),',',[&](std::string_view connected) {
-            auto num = to_int(connected.substr(1));
-            if(num < current) s.merge(num,current);
+            std::uint32_t num = to_int(connected.substr(1));
+            if(num < current) edges.push_back({num,current});
         });
     });
-    std::cout << "Part 1: " << s.findRoot(0).size << '\n';
-    std::cout << "Part 2: " << s.total_sets << '\n';
+    ConcurrentDisjointSets s(programs);
+    s.merge_batch(edges);
+    std::cout << "Part 1: " << s.size(0) << '\n';
+    std::cout << "Part 2: " << s.count() << '\n';
 }
 
 std::string_view input = R"(0 <-> 795
@@ -5,6 +5,12 @@
 #include <charconv>
 #include <numeric>
 #include <algorithm>
+#include <vector>
+#include <optional>
+#include <atomic>
+#include <thread>
+#include <bit>
+#include <cstdint>
 
 template<typename F>
 void split(std::string_view in, char delim, F&& f) {
@@ -41,21 +47,102 @@ auto parse(std::string_view input) {
     return std::pair{std::move(s),total};
 }
 
-auto part2(std::vector<Scanner> input) {
-    std::sort(input.begin(),input.end(),[](auto&& a, auto&& b){return a.period < b.period;});
-    auto caught = [&](int wait) {
-        return std::any_of(input.begin(),input.end(),[wait](const Scanner& s) {return (s.depth+wait) % s.period == 0;});
+//Allowed delays modulo period as a bitmask, with the first 64 bits repeated after the end so any 64 delay window is a single unaligned read
+struct Sieve {
+    std::uint64_t period;
+    std::vector<std::uint64_t> bits;
+
+    //members are {period, forbidden residues} pairs whose periods all divide this period
+    Sieve(std::uint64_t period, const std::vector<std::pair<std::uint64_t,std::vector<std::uint64_t>>>& members): period(period), bits((period+64)/64+2,~std::uint64_t(0)) {
+        for(auto& [p,residues] : members) {
+            for(auto r : residues) {
+                for(auto x = r; x < period+64; x += p) {
+                    bits[x/64] &= ~(std::uint64_t(1) << (x%64));
+                }
+            }
+        }
+    }
+
+    std::uint64_t window(std::uint64_t delay) const {
+        auto offset = delay % period;
+        auto word = offset/64, shift = offset%64;
+        return shift ? bits[word] >> shift | bits[word+1] << (64-shift) : bits[word];
+    }
+
+    double density() const {
+        std::uint64_t allowed = 0;
+        for(std::uint64_t x = 0; x < period; ++x) allowed += bits[x/64] >> (x%64) & 1;
+        return double(allowed)/period;
+    }
+};
+
+/*
+    Scanners are grouped by period into bitmasks of forbidden residues. The smallest periods are folded into one wheel of their lcm,
+    the rest are ANDed in most restrictive first, so every 64 delays cost one read per period and usually stop after a couple.
+    Blocks of delays are handed out in order to one thread per core, and the lcm of all periods bounds the search when there is no safe delay.
+*/
+std::optional<std::uint64_t> part2(const std::vector<Scanner>& input) {
+    constexpr std::uint64_t wheel_limit = 1 << 22;
+    constexpr std::uint64_t block = 64 << 12;
+
+    std::map<std::uint64_t,std::vector<std::uint64_t>> by_period;
+    for(auto [depth,period] : input) {
+        by_period[period].push_back((period - depth % period) % period);
+    }
+
+    std::uint64_t wheel_period = 1;
+    std::uint64_t bound = 1;
+    std::vector<std::pair<std::uint64_t,std::vector<std::uint64_t>>> wheel_members;
+    std::vector<Sieve> rest;
+    for(auto& [period,residues] : by_period) {
+        auto l = std::lcm(wheel_period,period);
+        if(l <= wheel_limit) {
+            wheel_period = l;
+            wheel_members.push_back({period,residues});
+        } else {
+            rest.emplace_back(period,std::vector{std::pair{period,residues}});
+        }
+        bound = bound > UINT64_MAX / period ? UINT64_MAX : std::lcm(bound,period);
+    }
+    Sieve wheel(wheel_period,wheel_members);
+    std::sort(rest.begin(),rest.end(),[](auto& a, auto& b) {return a.density() < b.density();});
+
+    std::atomic<std::uint64_t> next_block = 0;
+    std::atomic<std::uint64_t> best = bound;
+    auto worker = [&] {
+        for(auto start = block*next_block++; start < best; start = block*next_block++) {
+            for(auto d = start; d < start+block and d < best; d += 64) {
+                auto mask = wheel.window(d);
+                for(auto it = rest.begin(); mask and it != rest.end(); ++it) {
+                    mask &= it->window(d);
+                }
+                if(mask) {
+                    auto found = d + std::countr_zero(mask);
+                    auto current = best.load();
+                    while(found < current and not best.compare_exchange_weak(current,found));
+                    break;
+                }
+            }
+        }
     };
-    int current = 0;
-    while(caught(++current));
-    return current;
-    return 0;
+    std::vector<std::thread> threads;
+    for(unsigned i = 0; i < std::max(1u,std::thread::hardware_concurrency()); ++i) {
+        threads.emplace_back(worker);
+    }
+    for(auto& t : threads) t.join();
+
+    if(best >= bound) return std::nullopt;
+    return best.load();
 }
 
 void solution(std::string_view input) {
     auto in = parse(input);
     std::cout << "Part 1: " << in.second << '\n';
-    std::cout << "Part 2: " << part2(std::move(in.first)) << '\n';
+    if(auto delay = part2(in.first)) {
+        std::cout << "Part 2: " << *delay << '\n';
+    } else {
+        std::cout << "Part 2: no safe delay\n";
+    }
 }
 
 std::string_view input = R"(0: 4
@@ -1,40 +1,117 @@
 #include <iostream>
+#include <array>
+#include <vector>
+#include <algorithm>
 #include <cstdint>
 
 constexpr std::uint64_t N = (std::uint64_t(1) << 31) - 1;
 
-template<std::uint64_t Mult, std::uint64_t div>
+//N is a Mersenne prime, so 2^31 = 1 mod N and the high bits can be folded back onto the low ones
+constexpr std::uint64_t mod_n(std::uint64_t x) {
+    x = (x & N) + (x >> 31);
+    x = (x & N) + (x >> 31);
+    return x >= N ? x - N : x;
+}
+
+constexpr std::uint64_t pow_mod(std::uint64_t base, std::uint64_t exp) {
+    std::uint64_t result = 1;
+    for(; exp; exp >>= 1, base = mod_n(base*base)) {
+        if(exp & 1) result = mod_n(result*base);
+    }
+    return result;
+}
+
+constexpr int lanes = 8;
+constexpr std::uint32_t low_mask = (1 << 16) - 1;
+
+//Holds the next 8 values of the sequence, every lane jumps 8 steps ahead at once by multiplying with Mult^8
+template<std::uint64_t Mult>
 struct Generator {
-    std::uint64_t current;
-    auto part1_gen() {
-        current = current*Mult % N;
-        return current;
+    static constexpr std::uint64_t jump = pow_mod(Mult,lanes);
+    std::array<std::uint32_t,lanes> values;
+
+    explicit Generator(std::uint64_t seed) {
+        for(auto& v : values) {
+            seed = mod_n(seed*Mult);
+            v = seed;
+        }
     }
 
-    auto part2_gen() {
-        do {
-            part1_gen();
-        } while(current % div != 0);
-        return current;
+    void advance() {
+        for(auto& v : values) {
+            v = mod_n(std::uint64_t(v)*jump);
+        }
     }
 };
 
-int main() {
+//Only keeps the low 16 bits of the values that pass the div criterion, compacted into a buffer with branch free stores
+template<std::uint64_t Mult, std::uint64_t div>
+struct Filtered {
+    Generator<Mult> gen;
+    std::vector<std::uint16_t> buffer;
+    std::size_t size = 0;
 
-    constexpr std::uint64_t mask = (1 << 16) - 1;
+    explicit Filtered(std::uint64_t seed): gen(seed) {}
 
-    Generator<16807,4> A1{699};
-    auto A2 = A1;
-    Generator<48271,8> B1{124};
-    auto B2 = B1;
+    void fill(std::size_t n) {
+        buffer.resize(n+lanes);
+        while(size < n) {
+            for(auto v : gen.values) {
+                buffer[size] = v & low_mask;
+                size += v % div == 0;
+            }
+            gen.advance();
+        }
+    }
+
+    void consume(std::size_t n) {
+        std::copy(buffer.begin()+n,buffer.begin()+size,buffer.begin());
+        size -= n;
+    }
+};
+
+//Written as plain lane loops over the low 16 bits so they compile to vector compares
+template<typename T>
+int count_equal(const T* a, const T* b, std::size_t n) {
+    int total = 0;
+    for(std::size_t i = 0; i < n; ++i) {
+        total += (a[i] & low_mask) == (b[i] & low_mask);
+    }
+    return total;
+}
+
+template<std::uint64_t MultA, std::uint64_t MultB>
+int part1(std::uint64_t seedA, std::uint64_t seedB, std::size_t pairs) {
+    Generator<MultA> a(seedA);
+    Generator<MultB> b(seedB);
     int total = 0;
-    int total2 = 0;
-    for(int i = 0; i < 40'000'000; ++i) {
-        total += (A1.part1_gen() & mask) == (B1.part1_gen() & mask);
+    for(std::size_t i = 0; i < pairs; i += lanes) {
+        total += count_equal(a.values.data(),b.values.data(),std::min<std::size_t>(lanes,pairs-i));
+        a.advance();
+        b.advance();
     }
-    for(int i = 0; i < 5'000'000; ++i) {
-        total2 += (A2.part2_gen() & mask) == (B2.part2_gen() & mask);
+    return total;
+}
+
+template<std::uint64_t MultA, std::uint64_t divA, std::uint64_t MultB, std::uint64_t divB>
+int part2(std::uint64_t seedA, std::uint64_t seedB, std::size_t pairs) {
+    constexpr std::size_t chunk = 1 << 12;
+    Filtered<MultA,divA> a(seedA);
+    Filtered<MultB,divB> b(seedB);
+    int total = 0;
+    while(pairs) {
+        auto n = std::min(chunk,pairs);
+        a.fill(n);
+        b.fill(n);
+        total += count_equal(a.buffer.data(),b.buffer.data(),n);
+        a.consume(n);
+        b.consume(n);
+        pairs -= n;
     }
-    std::cout << "Part 1: " << total << '\n';
-    std::cout << "Part 2: " << total2 << '\n';
+    return total;
+}
+
+int main() {
+    std::cout << "Part 1: " << part1<16807,48271>(699,124,40'000'000) << '\n';
+    std::cout << "Part 2: " << part2<16807,4,48271,8>(699,124,5'000'000) << '\n';
 }
@@ -5,6 +5,8 @@
 #include <charconv>
 #include <numeric>
 #include <algorithm>
+#include <vector>
+#include <cstdint>
 
 template<typename F>
 void split(std::string_view in, char delim, F&& f) {
@@ -22,104 +24,166 @@ int to_int(std::string_view s) {
     return ret;
 }
 
-template<typename T>
-T fast_exponentiation(T start, std::uint64_t power) {
-    T result{};
-    while(power) {
-        if(power % 2) {
-            result *= start;
-            --power;
-        }
-        start *= start;
-        power /= 2;
+//perm[i] is where i goes. Composition applies this one first
+struct Permutation {
+    std::vector<std::uint32_t> perm;
+
+    explicit Permutation(std::size_t n = 0): perm(n) {
+        std::iota(perm.begin(),perm.end(),0);
     }
-    return result;
-}
 
-constexpr std::size_t NumPrograms = 16;
+    Permutation& operator*=(const Permutation& other) {
+        for(auto& p : perm) {
+            p = other.perm[p];
+        }
+        return *this;
+    }
 
-template<typename T>
-struct fill {
-    T start;
-    
-    operator std::array<T,NumPrograms>() {
-        std::array<T,NumPrograms> ret;
-        std::iota(ret.begin(),ret.end(),start);
+    //Every element only moves along its own cycle, so k steps is an index shift of k mod the cycle length. O(n) for any k
+    Permutation power(std::uint64_t k) const {
+        Permutation ret(perm.size());
+        std::vector<bool> visited(perm.size());
+        std::vector<std::uint32_t> cycle;
+        for(std::uint32_t start = 0; start < perm.size(); ++start) {
+            if(visited[start]) continue;
+            cycle.clear();
+            for(auto i = start; not visited[i]; i = perm[i]) {
+                visited[i] = true;
+                cycle.push_back(i);
+            }
+            auto shift = k % cycle.size();
+            for(std::size_t j = 0; j < cycle.size(); ++j) {
+                ret.perm[cycle[j]] = cycle[(j + shift) % cycle.size()];
+            }
+        }
         return ret;
     }
 };
 
+//Position moves and partner moves act independently, so a dance is one permutation of positions and one of names
 struct Dance {
-    std::array<char,NumPrograms> rename = fill<char>{'a'};
-    std::array<int,NumPrograms> shuffle = fill<int>{0};
+    Permutation shuffle;
+    Permutation rename;
 
-    auto toString() {
-        std::string res(NumPrograms,'a');
-        for(int i = 0; i < NumPrograms; ++i) {
-            res[shuffle[i]] = rename[i];
+    std::size_t size() const {
+        return shuffle.perm.size();
+    }
+
+    auto toString() const {
+        std::vector<std::uint32_t> line(size());
+        for(std::size_t i = 0; i < size(); ++i) {
+            line[shuffle.perm[i]] = rename.perm[i];
+        }
+        std::string res;
+        for(auto name : line) {
+            if(size() <= 26) {
+                res += char('a'+name);
+            } else {
+                res += std::to_string(name) + ' ';
+            }
         }
         return res;
     }
 
-    //Copy to safeguard against self-multiplication
-    Dance& operator*=(Dance other) {
-        for(int i = 0; i < NumPrograms; ++i) {
-            rename[i] = other.rename[rename[i]-'a'];
-            shuffle[i] = other.shuffle[shuffle[i]];
-        }
+    Dance& operator*=(const Dance& other) {
+        shuffle *= other.shuffle;
+        rename *= other.rename;
         return *this;
     }
 
-    Dance operator*(const Dance& other) {
-        Dance ret = *this;
-        return ret*=other;
+    Dance power(std::uint64_t k) const {
+        return {shuffle.power(k),rename.power(k)};
     }
 };
 
-auto parse(std::string_view input) {
-    Dance d;
+/*
+    Records a sequence of moves in O(1) each: spins only move an offset, and inverse arrays find the programs to swap without searching.
+    at/where map stored positions(shifted by offset) to starting positions and back, holder maps a name back to the label that currently carries it.
+*/
+class DanceBuilder {
+    std::size_t n;
+    std::size_t offset = 0;
+    std::vector<std::uint32_t> at, where;
+    std::vector<std::uint32_t> name_of, holder;
+
+    std::size_t stored(std::size_t pos) const {
+        return (pos + n - offset) % n;
+    }
+
+public:
+    explicit DanceBuilder(std::size_t n): n(n), at(n), where(n), name_of(n), holder(n) {
+        for(auto v : {&at,&where,&name_of,&holder}) {
+            std::iota(v->begin(),v->end(),0);
+        }
+    }
+
+    void spin(std::size_t k) {
+        offset = (offset + k) % n;
+    }
+
+    void exchange(std::size_t a, std::size_t b) {
+        auto pa = stored(a), pb = stored(b);
+        std::swap(at[pa],at[pb]);
+        where[at[pa]] = pa;
+        where[at[pb]] = pb;
+    }
+
+    void partner(std::uint32_t x, std::uint32_t y) {
+        auto i = holder[x], j = holder[y];
+        std::swap(name_of[i],name_of[j]);
+        holder[x] = j;
+        holder[y] = i;
+    }
+
+    Dance finish() const {
+        Dance d{Permutation(n),Permutation(n)};
+        for(std::size_t i = 0; i < n; ++i) {
+            d.shuffle.perm[i] = (where[i] + offset) % n;
+        }
+        d.rename.perm = name_of;
+        return d;
+    }
+};
+
+//Programs are named a to z, then aa, ab, ... like spreadsheet columns, or directly by their number as toString prints them past 26
+std::uint32_t program_name(std::string_view name) {
+    if(not name.empty() and name[0] >= '0' and name[0] <= '9') return to_int(name);
+    std::uint32_t ret = 0;
+    for(auto c : name) ret = ret*26 + (c - 'a' + 1);
+    return ret - 1;
+}
+
+auto parse(std::string_view input, std::size_t num_programs = 16) {
+    DanceBuilder d(num_programs);
     split(input,',',[&](std::string_view instruction) {
         auto i = instruction[0];
         instruction.remove_prefix(1);
         switch(i) {
-            case 's': 
-            {
-                auto rot = to_int(instruction);
-                for(auto& s : d.shuffle) {
-                    s += rot;
-                    s %= NumPrograms;
-                }
+            case 's':
+                d.spin(to_int(instruction));
                 break;
-            }
             case 'x':
             {
                 auto s = instruction.find('/');
-                auto a = to_int(instruction.substr(0,s));
-                auto b = to_int(instruction.substr(s+1));
-                auto aloc = std::find(d.shuffle.begin(),d.shuffle.end(),a);
-                auto bloc = std::find(d.shuffle.begin(),d.shuffle.end(),b);
-                std::swap(*aloc,*bloc);
+                d.exchange(to_int(instruction.substr(0,s)),to_int(instruction.substr(s+1)));
                 break;
             }
             case 'p':
             {
-                auto a = instruction[0];
-                auto b = instruction[2];
-                auto aloc = std::find(d.rename.begin(),d.rename.end(),a);
-                auto bloc = std::find(d.rename.begin(),d.rename.end(),b);
-                std::swap(*aloc,*bloc);
+                auto s = instruction.find('/');
+                d.partner(program_name(instruction.substr(0,s)),program_name(instruction.substr(s+1)));
                 break;
             }
         }
     });
-    return d;
+    return d.finish();
 }
 
 void solution(std::string_view input) {
     auto dance = parse(input);
 
     std::cout << "Part 1: " << dance.toString() << '\n';
-    std::cout << "Part 2: " << fast_exponentiation(dance,1'000'000'000).toString() << '\n';
+    std::cout << "Part 2: " << dance.power(1'000'000'000).toString() << '\n';
 }
 
 std::string_view input = R"(x13/9,s8,x4/12,s11,x9/6,pi/b,x5/0,pl/o,x11/14,pg/k,x8/1,pf/h,x2/13,s10,x14/10,pe/k,x3/6,pb/n,x0/4,s8,x12/2,pj/m,x7/8,s6,x15/6,s15,x14/11,s7,x13/3,s13,x15/2,s12,x9/0,s11,x5/11,s12,pi/d,x8/2,s9,x11/15,s3,x6/14,s10,x4/10,s9,x15/5,s10,x0/11,pc/n,x3/14,pa/b,x8/5,s8,x2/13,s14,x5/1,s12,x9/6,s13,x2/0,s8,x3/10,s7,x6/0,s1,x4/1,s11,x9/8,s3,x3/1,s1,x0/12,s3,x6/8,s9,x1/13,s14,x6/12,s5,pi/g,x0/8,pj/n,x2/4,ph/o,s10,x0/13,pd/c,s4,x2/9,pk/i,x4/11,pl/n,x5/14,s5,x11/4,s2,x7/1,s13,pc/h,x10/2,s12,pb/o,x14/8,s1,x4/7,s8,x2/13,s8,pl/f,x8/9,ph/n,x12/4,pi/m,s5,x11/2,pc/k,x6/14,pb/a,s8,x10/11,po/p,s13,x0/7,s13,x14/3,pj/m,x2/0,pb/e,x13/8,s11,x14/7,s5,x0/5,s6,x15/12,s12,x2/8,pc/l,x9/6,s7,x15/11,s13,x6/13,po/n,s8,x5/7,s8,x3/14,pd/g,x8/0,s1,x13/11,pp/a,x7/10,s9,pi/c,x1/9,pn/h,s7,x2/4,s1,x10/8,s1,x7/15,pj/m,x2/12,ph/l,x9/15,pf/e,x10/14,s1,x15/9,s12,x2/6,pp/a,x13/9,s12,x10/12,s5,x6/15,pe/b,x14/10,pg/i,x0/9,pl/n,x2/14,po/h,x3/5,s10,x14/9,pn/k,x4/3,s4,x9/2,s1,x1/7,pg/e,x11/6,s11,pf/o,s4,x15/12,s7,x5/3,s9,x13/7,pc/k,x4/6,s15,x9/5,pe/f,x1/12,s7,x9/11,s7,x0/3,s4,pl/g,x12/6,po/f,x13/5,s1,x8/7,s13,x9/10,pp/c,x0/13,s11,x15/10,pj/h,x3/1,s12,pm/d,x4/9,s4,x1/10,s13,x9/13,s10,x5/4,s12,pn/c,s2,x2/8,s4,x0/14,s10,x11/6,pf/a,x8/2,s8,x7/9,s2,x8/13,s9,x4/6,s10,pg/j,s11,x10/12,pd/h,x6/9,pp/n,x13/2,s1,x12/4,pe/b,x6/14,s6,x2/5,s7,x4/9,s7,x1/14,s15,x6/2,pn/c,x10/8,s13,x3/12,pe/k,s11,x14/10,s15,x1/7,s3,x6/9,s12,pi/l,x7/2,pg/f,x4/5,ph/j,x2/3,s2,x7/1,pf/m,x14/10,s1,x1/13,s11,pn/e,x15/2,pg/m,x3/4,s5,x6/2,s6,x5/10,s9,x0/8,s8,x1/11,s4,x13/0,s10,x8/2,pb/i,s10,x10/12,s12,x11/8,pk/c,x6/4,ph/g,x8/13,s11,pn/f,x0/6,ph/m,x11/9,pj/b,x8/13,s3,x15/5,s13,x9/6,pe/i,x4/3,s9,x1/6,s10,x13/14,s15,x10/15,pa/d,x9/12,s14,pm/f,x4/7,pk/l,x11/9,s10,x8/7,pn/f,x11/12,s5,x14/13,s15,x1/3,pb/j,x14/15,pl/p,s5,x7/2,pb/f,x5/3,s6,x2/1,pp/j,s3,x5/11,s4,ph/n,x15/7,pa/p,s9,pl/o,x13/1,s5,x15/14,s7,x12/7,pn/p,x8/15,pd/h,x13/3,pi/n,x11/7,pe/d,s2,x6/1,s7,x7/12,ph/n,x0/6,pl/e,x14/15,s13,x9/5,pa/c,x0/3,pb/m,x5/12,s9,x10/4,s5,x14/3,s14,x11/10,s2,x13/12,s13,x0/3,pi/k,x1/15,s1,x2/4,ph/a,s13,x14/6,s7,x1/15,s4,x7/8,pi/n,x2/6,s13,x12/9,s2,x5/1,s8,x15/12,s15,x1/3,s7,x15/10,pf/g,x1/3,s13,x12/11,pe/c,x13/3,ph/m,x14/9,s11,x12/15,s14,x3/10,pp/c,x9/8,s4,x13/10,s8,x2/8,s2,x9/0,pf/m,x11/14,pk/o,x8/6,s4,x3/2,s15,x4/15,s8,pj/p,x9/2,s6,x12/5,s1,x4/7,s6,x5/6,s11,x13/1,pl/n,x3/4,pa/m,x13/14,pl/b,s10,x4/2,s15,x12/11,pc/h,x10/13,pi/g,x14/7,s7,x13/5,pn/m,x9/2,s12,x5/3,s13,x7/4,s15,pk/a,x11/15,s10,x10/1,s11,x12/14,pj/m,x2/15,s7,x14/6,s7,x0/9,s14,x10/3,s6,x6/14,pd/o,x5/11,pj/b,x0/4,s13,x14/3,pf/p,x15/2,s1,x4/5,s5,x1/2,s2,x14/5,pd/j,x4/15,ph/p,x10/6,s4,x1/8,s1,pj/n,x14/3,s1,x12/2,s9,x3/1,pe/k,x14/6,s2,x2/12,pi/n,x3/9,pa/c,x14/11,s14,x15/6,s7,x7/8,pf/m,x6/5,pe/b,x14/1,pd/l,x8/7,s8,x2/9,pa/i,x3/5,s1,x8/14,pp/e,s11,pl/c,s10,x6/1,s5,x2/3,s2,x10/14,s13,x11/8,pi/a,x7/1,pj/b,x13/12,pn/p,x2/4,s8,x10/9,s12,x0/12,ph/j,x4/14,pg/b,x9/5,s6,x8/15,s7,x6/7,po/n,x14/3,pm/i,x12/2,pn/o,x9/13,s1,x1/4,pe/p,x13/14,s2,x6/8,s12,x3/4,pi/b,x12/14,s10,x6/7,s1,x0/14,s12,x9/15,s9,x5/1,s7,x0/4,s15,x2/15,pk/j,x13/6,s12,x3/14,s1,x9/7,s12,x3/6,pa/n,s2,x5/15,pc/i,x2/0,po/n,x11/12,s10,x9/8,pk/j,x13/12,pa/n,x15/5,pb/l,x10/4,pe/d,x7/2,pn/g,x14/1,s10,x12/4,s5,pf/i,s2,x15/6,s2,x12/5,pe/n,x14/0,s1,x5/7,pi/c,x14/8,s2,x11/4,pl/a,x15/6,s2,ph/e,x10/14,pk/c,x1/9,s8,x6/4,pm/l,x12/11,s14,x4/0,pf/d,x11/13,s9,x1/7,s8,x12/6,pg/c,x9/1,s11,x5/8,pj/o,x4/11,s11,x3/13,s8,x12/1,pn/c,x10/8,pi/o,x0/14,s14,x8/7,s9,x11/13,pc/h,x10/7,s6,x4/1,po/l,x5/14,pc/f,x6/8,s12,x10/1,s13,x4/9,s14,x12/0,s4,x3/4,s2,pi/b,x15/14,s10,x3/11,pf/l,x14/2,s15,x9/11,pc/i,x0/14,po/l,x13/9,pn/h,x15/6,pf/c,x8/12,pi/l,x9/0,pn/e,x10/2,s8,x13/3,s5,x7/5,s12,x6/9,s10,x8/11,s14,x14/3,pa/d,x10/8,pj/o,x15/3,s15,x0/4,s5,x11/3,s12,x14/13,s11,ph/e,s7,x3/2,s3,x13/4,s12,pa/l,x6/7,pn/g,x13/1,s13,x7/5,s9,x12/2,s2,x15/9,pd/l,x13/0,s8,x7/4,pa/n,x0/11,s8,x14/8,s12,x0/4,s7,x5/11,s11,x15/3,pe/d,x8/14,pl/b,x11/12,pm/a,s4,x7/15,pi/h,x8/2,pj/l,x13/0,s4,x7/10,ph/p,x0/2,pl/n,x13/4,pc/g,x12/7,pp/b,x5/1,pk/j,x10/8,pc/d,x7/9,s7,x0/13,pf/h,s8,x15/11,s4,x8/5,s12,x12/11,s13,x7/6,s14,x5/3,pe/p,s2,pg/i,x9/4,s5,x6/3,s2,x11/5,s13,po/f,x6/4,s15,x13/5,pi/m,x10/6,s10,x12/14,s12,x8/5,s15,x0/4,s12,x15/8,ph/e,x5/10,s15,x14/13,pa/l,s9,x4/10,s9,x15/0,pm/e,x2/9,s12,x5/4,pa/d,x3/13,pb/f,x10/6,s6,x7/2,pi/o,x12/0,s7,x9/7,s12,x1/3,pg/p,s4,pa/e,x9/14,s14,x3/6,ph/p,s1,x11/2,s11,x12/1,pe/o,x3/15,s9,pf/c,x7/2,pb/o,x1/13,pj/p,x4/14,s13,ph/f,s6,x6/3,s3,x7/4,s10,x6/12,pd/o,x3/10,s1,pi/e,x5/9,s9,x12/13,s13,x2/10,po/n,x14/13,s1,x3/15,pj/e,x2/4,pp/g,x8/0,s5,x15/1,s2,x3/2,s2,x14/1,s3,x6/15,s14,po/k,x14/0,pm/p,x12/8,s9,x11/6,s15,x7/5,s3,x1/2,s4,x10/6,s8,x2/11,s11,x8/7,pn/f,x2/13,s11,x1/5,pa/b,x9/0,s1,x10/4,s13,x11/6,s9,pp/g,x9/7,s3,x3/14,po/n,x7/6,s4,x1/9,s6,x2/6,pi/a,s13,x11/10,s10,x7/14,s12,pn/o,x4/9,s11,x15/8,s5,x5/1,s6,x13/12,s12,x4/3,s14,x13/12,ph/i,x10/1,pd/m,x8/6,s2,x15/4,pi/o,x14/1,pk/h,x10/13,s7,x15/14,pf/i,s13,x9/4,pp/j,s2,pm/f,x6/12,pp/n,x11/3,s4,x4/9,s3,x15/2,s14,x14/6,pb/e,x13/11,pl/c,x8/0,pf/n,x14/3,s1,x4/7,pi/k,x11/6,pa/l,s7,x5/0,s15,x7/2,pc/g,x6/11,pn/k,x13/10,s5,x0/11,s15,x9/4,s9,x13/5,s5,x2/1,s15,x4/8,pj/d,x7/12,s2,x8/0,s8,x12/4,s5,x13/15,s1,x14/2,pi/a,x13/10,s6,x3/2,s5,x13/11,s13,x5/6,s10,pc/m,x7/3,pg/e,s5,x15/14,pf/m,x4/12,s4,x1/5,pd/n,x3/11,pm/f,x8/13,pb/g,x9/6,pl/c,x5/15,po/i,x11/3,pc/f,x0/12,s4,x13/5,ph/j,x6/2,pf/b,x3/7,s9,x1/13,s13,x15/5,s10,x7/4,s9,pn/i,x10/8,s10,x9/11,pc/k,x10/0,s9,x6/2,s3,x15/1,pe/i,s5,x9/14,pa/l,x0/4,s15,x8/1,s13,x4/7,s3,x5/6,s4,x0/10,po/k,x14/8,s3,x11/4,s6,x9/2,s13,x8/3,s4,x1/7,s2,x5/9,pn/g,x10/0,s14,pj/i,x15/2,s3,pk/h,s13,x5/4,pb/n,x12/13,pl/d,x0/7,pn/k,x3/13,s5,x8/4,pi/m,s5,pf/g,x3/12,pc/m,x2/0,pf/p,x4/11,s10,x12/15,ph/g,x2/6,s12,x13/7,pa/k,x1/0,s7,x14/12,s14,x11/5,s10,x3/0,pc/b,x13/11,s2,x0/4,pf/m,x9/14,s14,x13/3,s4,x6/0,pc/l,x12/3,s6,pg/a,s6,x8/1,pc/n,x6/13,s8,x4/5,s13,x3/6,ph/g,x8/1,pe/b,x6/2,pa/p,x3/11,ph/d,s13,x5/1,s10,x7/4,s10,x13/0,pm/k,x9/12,pl/j,x5/7,s10,po/p,x0/8,s13,x7/9,pl/n,x1/10,s12,x9/6,s3,x1/0,s1,x14/5,s9,x11/7,s4,x0/12,s10,x1/9,pk/a,x10/4,s1,x3/15,pg/h,x5/1,pk/b,x12/4,pf/e,x6/13,pm/j,x2/10,s2,pc/i,x12/14,s14,x7/9,s6,x10/6,s6,x4/2,pb/o,x7/15,s5,x0/2,pe/g,x7/14,s1,pp/m,s2,x1/11,s1,x6/14,s12,x1/12,s3,x8/4,s3,x15/3,s9,x11/13,pl/j,x10/7,pa/i,x11/9,s12,pg/n,s9,x5/7,pe/a,x9/8,s4,pn/h,x15/0,pj/g,x11/6,pc/m,x0/13,s3,x1/4,pa/d,x0/12,s12,x7/8,s15,x4/15,s10,x3/13,s6,x5/14,s12,x0/12,s15,x9/2,s2,x8/14,s2,x7/9,ph/l,x14/3,s10,x10/7,pe/n,x12/9,pp/j,x10/15,pc/f,x7/5,ph/g,x10/15,pf/a,x5/11,pe/o,x8/7,s1,x11/13,s7,pa/g,x14/9,s9,x8/0,s15,x11/4,s1,x3/12,s12,x1/9,pk/e,x6/8,pc/f,x15/11,s10,x9/5,s14,x11/6,s11,x2/4,s7,x11/6,po/m,s13,x12/14,pf/k,x6/15,s15,x5/8,pe/c,x1/11,pl/d,x15/5,s6,x4/3,pi/h,x8/6,pd/l,x7/14,s4,pf/a,x12/9,s15,pj/k,x6/1,s9,x11/12,s3,pp/c,x8/14,pn/i,x0/2,pp/m,x9/12,s15,x15/7,s4,x0/2,s1,pn/k,s5,pd/j,x3/9,pk/m,x15/10,pl/d,x13/11,s10,x5/12,s5,pj/h,x8/4,pd/m,x1/7,s8,x13/11,s9,x12/6,s5,x15/13,pe/l,x7/10,s11,x11/8,s3,x2/5,pa/g,x11/13,s3,x2/15,pk/f,x7/14,s1,pm/g,x15/12,s15,x4/8,pk/l,s9,x14/7,s8,x2/9,pb/j,x13/8,s1,x7/6,pc/m,s12,x11/4,s14,x13/10,s11,x8/12,ph/g,x4/9,s11,x10/5,s14,x8/11,s2,x3/10,s3,x6/2,s14,x3/11,s13,x10/12,s5,x15/4,pi/b,x9/2,pg/n,x15/3,ph/i,x11/8,s7,x15/3,s4,x13/12,s14,pk/l,x7/5,pp/g,x2/8,s15,x11/12,pf/e,x4/8,s11,x10/6,pj/d,x15/5,s13,x7/9,pl/a,x3/6,pn/i,x2/12,pf/j,x0/6,s3,x1/8,pd/p,x4/6,pe/k,x5/12,pl/p,s7,x6/1,pn/f,x5/4,s1,x14/13,pk/o,s5,x15/4,s4,x8/11,s1,pl/f,s10,x3/4,s15,x6/10,pc/k,x2/14,s5,x1/10,pe/m,x0/3,pf/i,x1/6,pj/l,x4/10,pn/d,x3/2,s12,x0/4,pg/b,x12/5,s3,x14/0,s10,x12/7,s2,x5/13,po/f,x1/11,s13,x10/5,s5,x6/13,pc/n,x2/5,s5,x4/9,pa/m,x15/7,s5,x2/10,pf/l,s15,x12/14,s9,pd/k,x13/4,s9,x14/5,s6,pi/a,x6/9,pn/m,x0/2,pe/j,x6/13,pk/o,x2/9,s11,x1/3,pb/a,x2/7,pi/g,x5/9,pf/k,x2/11,s4,x0/9,s10,x2/3,s8,x12/9,s1,x0/5,s4,x3/2,pm/d,x14/5,s10,x13/9,s14,x14/12,s2,x0/5,s7,x2/14,pg/k,x7/4,pb/n,x0/11,s14,x9/12,pc/i,x2/4,s15,x15/3,s13,x2/4,s13,x10/3,s5,x4/8,s8,x14/13,s9,x5/6,s12,x15/1,pm/o,x8/3,s7,x12/1,s3,x15/13,pn/f,x3/1,s7,x0/2,po/g,x14/3,pn/j,x6/8,s14,x11/5,s14,x9/3,pb/l,x0/6,pe/p,x2/9,s8,pj/h,x6/11,pk/o,s9,x5/12,pc/h,x3/9,po/e,x15/2,s8,x5/11,s15,x9/10,pj/k,x6/0,pm/f,x10/1,pk/o,s12,x13/3,s15,x15/12,s5,pl/j,x1/6,s13,ph/p,x13/2,s8,x9/0,s12,x11/14,pa/k,x15/7,s13,x12/14,s15,x7/9,s5,x15/0,s14,pe/i,s6,x1/2,s1,x11/13,s8,x14/2,s14,x11/4,pf/n,x5/13,pm/i,x14/2,s5,x13/11,pg/b,x2/0,s11,x13/10,pf/c,x14/11,ph/l,x15/1,pi/j,x6/4,pa/e,s14,x0/8,pn/k,x6/1,s2,x5/8,pp/c,x12/0,s12,x10/2,pd/g,x8/14,s5,x11/2,pi/j,x8/14,s6,x11/2,s4,x6/13,s9,x5/0,pc/p,x11/2,s11,x14/10,pi/e,x2/7,s12,x4/15,s6,x5/0,pk/l,x2/15,s13,x12/9,s9,x0/3,pp/m,x4/15,s13,x1/5,s13,x14/11,pb/a,x8/12,s5,x7/4,ph/k,x10/12,s9,pn/i,x2/13,pf/a,s6,x9/15,pm/n,s15,x6/11,s2,x15/3,pk/h,x1/13,s8,x6/12,s2,x3/5,s3,x8/12,s1,x10/15,pf/n,x14/3,s13,x9/7,s3,x0/1,s14,x7/11,s12,x2/13,pa/o,s15,ph/g,x1/4,s10,x3/12,s15,x15/9,s1,x1/2,s7,pn/m,x10/12,s12,x8/0,pe/h,x1/2,s11,x7/10,pc/a,x0/3,pn/p,x10/7,s8,x13/4,ph/b,x6/2,pi/l,x13/14,s5,x2/7,s5,x9/4,pm/d,s13,pi/e,x0/12,pj/o,x4/14,s5,x1/12,s5,x2/5,pg/l,x6/15,s10,x8/7,s4,x10/15,s10,x8/0,s14,x6/1,s6,x7/13,s4,x10/4,s5,x3/7,pi/o,x2/15,s4,x14/13,pa/g,x11/2,pm/f,x5/7,pi/k,x14/15,s11,pf/j,x0/4,s12,pc/d,x11/10,s11,pn/h,x12/9,s1,x5/10,pf/e,s1,x1/4,s5,x13/5,pi/a,x3/7,s2,x14/4,s15,x6/9,s10,x15/7,s6,x1/8,pg/l,x10/13,s12,x12/1,s7,pb/i,x4/2,pa/p,x1/15,s10,x0/9,s2,x6/1,s9,pb/c,x15/10,pe/p,x0/4,s6,x10/8,s2,x6/14,s6,x4/10,ph/m,x0/14,pn/a,x3/7,pc/i,x14/12,s9,x9/7,pn/o,x0/6,s7,x2/7,pc/g,x15/1,pl/h,x7/11,pa/p,x5/13,pj/l,x8/4,s7,x0/2,s11,x13/10,pk/b,x12/5,s8,pn/m,x9/7,s1,x4/8,pl/o,x7/0,pp/g,x9/5,pj/a,x7/6,pc/o,x0/1,s7,x6/4,s9,x13/3,pa/b,s10,pk/o,x9/7,s4,x0/4,pc/m,x7/13,s4,x15/0,s5,x2/14,s12,x15/0,pf/k,x7/9,s12,x8/11,s3,x6/1,s12,x15/3,s3,x10/5,pi/l,x15/3,pk/d,x8/9,pj/n,x3/0,pb/g,x15/6,pe/k,x12/2,s4,x8/0,s14,x12/13,pg/c,x8/9,pf/n,x6/11,s11,x7/0,pc/h,x6/9,pf/n,x7/10,pi/h,x12/8,s1,x11/0,s4,x6/15,s14,x5/14,s3,x12/10,s6,x11/9,s13,x1/10,s10,pf/c,x14/15,s11,x2/8,ph/i,x9/0,s9,x1/5,pf/a,x13/14,pm/b,x7/10,pl/i,x15/9,s10,x5/3,pb/n,x12/1,s5,x7/0,pk/h,x8/11,pj/a,x10/13,pe/d,x15/12,pp/o,x13/11,s10,pn/a,s9,x6/7,s10,x14/8,s8,x5/9,s6,x12/3,pg/l,s7,x10/5,s11,x12/11,ph/k,x10/7,pi/l,x8/9,s3,x2/14,s7,x13/9,s2,x11/2,pk/d,x8/1,s13,x12/9,pg/l,x11/1,s7,pd/o,s15,x10/13,pn/a,x11/7,s15,x1/9,pf/p,x7/5,s14,x3/14,s4,pg/m,x4/6,s1,x9/5,s5,x2/15,s7,x6/5,s13,x1/11,s13,x7/9,s7,x3/14,s2,x12/0,s11,x15/10,s2,x0/8,s7,x2/13,pf/d,x1/14,s5,x9/0,ph/j,x6/15,pg/f,s2,x12/5,s14,x8/3,pm/a,s11,x7/2,s15,x1/11,s1,x4/8,ph/p,x0/1,pl/k,x9/8,pp/h,x2/13,s2,x8/11,pm/k,x6/10,pg/e,x4/0,s11,x10/12,pc/k,x0/9,po/f,x5/10,s14,x1/7,pj/h,s14,x4/6,pn/p,x5/0,pb/k,x11/3,pg/n,x6/2,pi/d,x14/1,s10,x2/13,pe/p,x10/11,pl/k,x7/9,s1,x15/8,po/d,x7/4,s8,x13/12,ph/l,s9,x10/2,po/f,x7/14,pa/e,x4/12,pj/i,x0/9,s5,x3/11,s12,x12/13,po/m,s7,x6/10,s15,x5/13,pl/n,x9/2,pj/a,x13/6,s6,x14/11,s11,x1/12,s15,x0/11,pf/o,x14/1,s3,x6/11,s4,x13/1,s4,x7/12,pk/b,x5/8,pe/f,s5,x6/7,s12,pb/n,x11/3,s11,pf/p,x12/10,s13,x0/14,s6,x12/5,pb/i,x9/13,s8,x15/6,s9,x8/14,s6,x13/3,pd/e,x8/14,pn/j,x2/5,s9,x10/6,s12,x8/13,pm/l,x3/2,s14,x14/1,s12,x13/8,pc/o,x1/14,s3,x2/8,s2,pa/f,x10/15,pg/e,x13/6,s1,x14/12,s14,x9/8,s2,x10/3,pj/a,x14/5,pi/d,x15/12,s11,x6/8,s12,pa/b,x9/4,pc/g,x7/5,s15,x8/13,s1,x9/4,pn/i,x10/11,pk/g,x0/9,s10,x13/1,pn/p,x3/0,s4,x7/14,s12,x15/10,s1,x13/7,s8,pi/l,x4/10,s6,ph/f,x7/6,pl/g,x14/2,pc/d,x8/6,s5,x13/15,s6,x3/14,s6,x8/13,pk/n,x1/4,pb/i,s12,x9/8,s8,x15/12,s2,x14/7,ph/m,x13/6,s9,x8/7,pa/f,x11/15,s9,x0/9,s14,x15/3,s10,x2/0,pc/p,x15/13,ph/b,x8/7,s12,x9/14,s15,x1/4,s6,x5/14,pm/c,x11/12,s8,pf/p,x3/15,s4,x1/11,s3,x15/13,pm/d,x8/5,s8,x7/14,pn/c,s15,x9/5,s8,x2/10,s15,x11/15,s12,x12/10,s8,pi/p,x5/1,s6,x11/4,pb/a,x0/14,s12,x3/7,pc/n,x9/14,s12,x10/5,s2,x9/1,s5,x4/5,pp/l,x9/1,pj/m,x10/14,pd/h,s1,pc/o,s5,x4/5,pn/e,x3/0,s11,x15/9,pl/h,x2/12,s13,x0/5,pb/m,s2,x8/7,pp/g,x14/2,s9,x9/10,s3,x7/14,s1,x4/1,s8,x7/6,pb/n,x9/13,s10,x14/7,pd/f,x5/11,s3,x0/2,pb/m,x10/9,s14,x14/1,s7,x3/0,pj/f,x13/4,s11,x12/6,pc/l,s8,x4/15,s9,x5/13,pg/m,x9/7,s14,x11/2,pd/f,x9/4,s15,x11/13,s5,x10/1,s4,pa/p,x9/11,s4,pf/j,x14/1,s4,x10/2,s1,pa/b,x7/0,pi/h,x9/1,s14,x8/15,pm/l,x1/9,pf/p,x6/12,s13,x10/11,s9,x8/4,s9,x15/11,s13,x2/5,s4,x9/4,pg/i,x5/7,ph/k,x6/10,s1,x2/5,pb/f,x12/8,s7,x5/4,s5,pj/c,x11/14,s8,x4/9,pn/e,s8,x15/14,pk/a,x2/4,s4,x13/14,s4,x7/9,pg/c,x0/10,pd/m,x2/9,s13,x14/8,pb/a,x3/0,pc/m,s9,x9/8,s11,x3/10,s5,pl/g,x8/15,pk/i,x1/5,pp/b,x14/4,s3,pc/o,x6/8,pd/h,s1,pk/j,x10/5,s5,x11/15,pp/h,s5,x4/14,s9,pm/l,x1/5,s10,x6/3,s1,x8/0,s7,x9/2,pn/e,x11/12,pk/d,x13/9,s9,x15/1,s13,x13/14,s3,x3/7,s3,pm/h,x2/13,pn/o,x15/10,s11,pj/p,x13/8,s15,x5/10,s8,x2/15,pf/i,x5/9,s11,x15/0,s10,x7/1,s15,x2/8,pk/n,x4/9,pl/f,x0/13,s4,x7/1,s1,x15/12,s7,x13/0,pd/o,x3/4,s4,x7/6,pb/n,x9/12,s4,x15/14,s14,x13/2,pe/d,x1/6,s14,x15/8,s14,x6/0,s15,x7/2,pj/n,x5/11,pf/g,x3/2,s1,x10/1,s2,x14/9,s11,x6/2,s13,x1/11,po/m,s3,x3/13,s11,x12/2,s11,pj/g,x4/15,s1,x3/14,pd/l,x9/1,ph/f,x2/11,s15,x12/10,s5,x3/6,s15,x0/7,po/i,x15/9,pf/h,x1/5,pj/n,x12/14,pf/c,x7/11,s3,x6/4,s5,pn/b,x1/3,s2,po/m,x0/7,pb/h,x13/5,s15,pk/l,x7/11,s11,x0/15,pd/n,x12/1,pe/k,x15/14,s2,x1/8,s5,x3/5,pm/f,x11/10,s4,x9/14,s11,x0/4,pb/a,s13,x10/1,s13,pn/h,x4/13,s9,x1/14,s14,x10/12,pd/e,x6/0,pc/o,x4/13,s14,x10/3,pb/p,x2/8,s13,x0/6,s9,x5/14,s1,x2/4,pi/g,x14/6,s2,x7/5,s10,x13/1,pm/o,x4/12,s10,x14/0,s13,x15/3,s10,x13/11,pe/g,x5/15,s3,x12/6,s14,x0/3,pn/l,x12/5,pd/k,x10/8,s1,x2/5,s6,x14/6,s9,x10/1,s9,x14/7,s14,x5/11,pl/f,s6,pp/i,x13/4,s12,x5/15,pl/f,x2/1,s7,x3/7,s9,x2/0,s9,x6/8,s4,x0/14,pm/e,x3/7,pb/f,s7,x14/2,s11,x7/8,s15,x15/6,s4,x4/14,s3,x0/11,pg/n,x13/1,s11,x9/5,s10,x7/12,pf/m,x9/13,s12,x14/4,s9,x12/11,s8,x5/13,s1,x10/6,ph/k,x13/0,pf/o,x12/6,s8,x3/5,pa/g,x10/9,pc/l,x3/0,s11,x2/15,pn/i,s6,x5/9,s5,x11/6,s15,x14/3,ph/m,x11/4,s3,x5/15,pg/f,x4/2,pd/m,x11/6,pa/l,x4/9,pn/b,s2,x8/3,pj/o,x12/1,pg/i,s11,x11/3,s10,x10/14,pf/j,x13/6,s2,x14/2,pg/l,x7/9,pf/d,x11/15,s2,x8/0,s13,x5/10,s9,x4/15,s7,po/l,x6/0,s4,x5/8,s3,x3/4,s15,x12/6,s2,x11/8,pn/e,x10/15,s11,x13/12,s2,x3/8,po/c,x6/4,s4,x0/1,pk/n,x5/2,s6,x6/14,pa/e,x12/8,pn/p,x6/9,pg/h,x0/1,pi/k,x5/7,pj/c,x13/1,s12,x11/8,s15,x6/5,pk/h,s12,x9/4,pd/o,s2,x0/12,pe/p,x7/11,pd/j,x1/6,s2,x15/5,s4,x0/9,s1,x7/11,pf/l,x2/14,pg/c,x6/8,s10,x4/7,s6,x9/12,s12,x14/7,pi/p,x13/0,s11,x1/12,s3,x14/13,s8,x2/15,pf/d,x12/3,pj/g,s14,x8/15,s4,x6/1,pf/a,s10,x13/7,pm/n,x8/10,pd/p,s1,x5/1,s11,x11/8,s14,x4/1,s13,x15/6,pc/j,x4/2,ph/o,x0/7,s15,x13/8,pf/a,x3/4,pb/d,s10,x0/1,pp/f,x14/5,s2,x8/0,pm/g,x13/10,s8,x6/2,pd/h,x11/7,s7,x6/2,s7,x3/10,pf/l,x7/13,s11,pg/a,x6/1,s10,x0/4,s5,x3/1,s8,x12/10,s6,pp/o,x4/6,pf/e,x15/5,s4,x1/2,s4,x10/15,s2,x2/3,pb/g,x14/8,s11,x3/10,s6,x6/5,po/k,x2/8,s5,x14/9,pb/j,x11/15,pi/l,x4/9,s5,x14/2,pj/a,x12/6,s1,pc/i,x7/8,pj/n,x3/1,s14,pg/f,x13/11,s11,x1/15,pi/o,x0/4,s2,pa/h,s1,x15/1,s1,x3/6,pj/g,x1/4,po/f,x13/14,pn/g,x7/8,s2,x0/3,pc/h,s7,x10/6,pf/l,s1,x8/7,s11,x3/1,s9,x11/7,s1,x9/6,pm/i,x4/2,pa/h,s6,x7/6,pp/n,x2/9,s15,x10/5,s1,x2/6,s7,x8/4,pm/d,x15/10,s11,pe/f,x5/6,s15,x9/11,s6,x6/15,pg/c,x2/8,pn/l,x10/12,s14,x4/8,s6,x12/1,s12,x4/7,s9,x10/1,s6,x11/8,s9,pp/c,x0/13,po/f,x4/8,s5,x7/0,s1,x13/8,ph/c,x15/1,s1,x11/14,s8,x3/5,po/d,s2,x8/4,s12,x11/12,pl/m,x4/2,s12,x0/7,ph/n,x13/8,s6,x1/5,s8,x6/12,s13,x14/15,pe/b,s2,x4/3,pk/o,x0/14,pb/h,s11,x13/6,s2,x4/5,po/d,x0/2,s2,x11/8,pk/h,x3/7,pp/m,x14/4,s7,x1/0,s4,pd/f,x3/5,s4,x7/13,s8,x12/5,pp/b,x13/10,pj/i,x1/8,s11,x12/15,s5,x11/6,s14,x3/13,pb/o,x0/2,s6,x1/3,pf/e,x8/10,s11,x12/2,s10,x10/0,pg/d,s3,pc/b,x2/8,s9,x1/4,pl/n,x12/0,s2,pp/a,x11/13,s8,x0/12,pj/o,x7/11,pi/m,x3/13,pb/p,x2/14,pg/j,x6/5,pk/l,x4/10,s1,x8/15,s3,x4/9,s3,x12/13,s2,x5/11,pi/c,x6/13,s12,x15/2,s4,x9/13,s3,x12/8,pl/n,x6/7,ph/e,x5/11,s2,x1/7,s7,x10/8,s8,x1/12,s7,x4/3,s5,x1/14,s3,x11/4,s8,x0/6,s9,x4/10,s9,x7/5,s15,x2/11,pg/m,x4/5,s7,x14/3,pl/b,x1/8,pk/p,x13/15,pe/o,s12,x8/14,s15,x9/7,pl/d,x3/14,pg/p,x11/6,s1,pc/f,x15/7,s8,x10/4,s5,x9/15,pg/b,s6,x8/13,s8,x2/14,s4,pc/j,s10,x5/15,pg/f,x12/0,s11,x3/14,pp/i,s3,x1/9,s9,x5/15,po/e,x8/6,s3,x9/2,pl/d,x6/15,pi/a,x2/5,s14,x11/9,s15,x12/4,pj/p,x2/10,po/i,x5/12,s6,x15/9,s4,x10/0,pj/g,x4/5,s10,x12/15,s8,x5/13,s11,pk/p,x9/12,s14,pd/c,x15/6,s1,x14/8,s1,x0/1,s6,x5/8,s6,x10/13,pg/m,x3/14,s8,x9/7,ph/k,x8/10,pb/g,x0/2,pk/p,x9/5,pb/a,x3/1,pn/i,x2/9,po/f,x3/13,s3,x12/6,s15,x9/11,s3,pi/a,x10/12,s15,x7/9,pf/j,x15/12,pc/d,x7/10,s13,x14/3,s5,x5/2,s15,x11/7,s14,x12/0,pn/a,x15/8,s12,x9/12,s1,x5/4,s12,ph/o,x13/10,pa/m,x1/8,po/i,x13/0,pl/c,x7/15,s7,pk/e,x0/10,s11,x6/15,pd/n,x0/5,pe/b,x14/12,pa/i,s5,x9/7,s3,x1/13,s3,pj/p,x4/6,s7,x1/2,pm/f,x8/4,s14,x5/10,s11,x1/4,pj/p,x6/13,s7,x12/14,pi/e,x5/15,s2,x14/4,pg/j,x7/2,pl/b,x6/10,s9,pf/a,x8/5,ph/n,x0/12,s6,x9/6,s13,x11/3,s11,x4/0,po/d,x1/5,pl/c,x10/15,s12,x7/1,s5,x14/10,s12,x5/13,pa/p,x15/0,s13,x4/12,s5,x13/0,pf/d,x1/8,pk/l,x3/11,s11,x7/5,s3,pm/h,s5,x3/6,s10,x2/11,s7,x7/6,pe/p,x8/4,s9,x1/2,s9,x4/11,s14,x7/9,po/b,x14/10,s5,ph/n,x6/8,pj/f,x14/2,s5,x9/6,s8,x2/14,s11,x4/10,pi/e,x8/15,s2,x5/13,pk/h,x8/14,s14,x9/10,s1,x0/7,s12,x2/6,s12,x0/12,s7,x10/4,s7,x15/6,pi/c,x14/7,pk/a,x5/10,pg/f,x9/4,s15,x14/10,s7,x7/0,po/a,x6/2,pg/e,x8/4,s4,x12/14,pk/b,x13/6,ph/m,s9,x10/14,pp/d,x12/7,s6,x15/13,pc/e,x5/7,pj/h,s12,x8/9,s12,x13/15,s9,x4/0,s9,x13/8,s8,x15/11,s7,x6/7,pp/c,x5/12,pd/k,x10/7,pa/o,x6/15,pj/p,x13/5,s14,x11/14,pc/e,x12/5,s3,x14/11,s13,x5/10,pl/g,x1/9,pp/i,x15/5,s13,x8/11,pk/n,x1/13,pg/h,x9/3,pm/i,x2/8,s10,x6/11,s10,x13/12,s14,x4/7,s13,x2/15,s3,x12/5,pa/f,x6/7,s2,x5/10,s1,x14/4,s6,x6/0,pm/e,x2/11,pl/c,x9/12,s15,x6/1,pd/a,x15/10,s10,x5/0,s8,x1/15,s4,x4/7,s10,x5/9,pi/n,x15/12,s7,x2/6,pc/p,x14/12,pg/e,x7/5,s13,x2/11,s10,x13/5,ph/l,x3/2,s5,x9/6,s1,x10/11,pn/c,s6,x3/8,pj/d,x2/0,s6,x3/11,s1,x8/2,s11,x0/5,s2,pb/h,x10/15,pn/g,x12/7,po/a,x2/9,pe/p,s8,x4/5,s14,x10/6,pn/m,x15/4,s14,pj/k,s10,x1/7,s14,pf/l,x6/11,s15,x10/0,pp/g,x11/4,s5,x2/12,s4,x7/0,pi/b,x15/1,pd/j,x7/12,ph/p,x6/2,s3,x13/10,po/f,x0/1,pc/b,x10/11,ph/m,x3/9,s9,pe/n,x12/10,pb/i,x0/8,pd/a,x2/7,ph/k,x13/15,pn/f,s10,pc/k,x3/0,s2,x11/2,pd/g,x0/5,pe/a,x13/10,pm/g,x11/14,pk/d,x15/10,s9,x9/6,s10,x10/14,s13,x0/6,s2,x8/11,s9,x7/12,s12,x4/2,s15,x13/14,s7,x6/0,s2,x11/7,s9,x13/0,s10,x3/11,s5,x13/12,s10,x10/1,s5,x6/2,s15,x9/8,pm/i,s11,x10/3,s4,x4/14,s10,x8/1,s4,x0/15,s2,x3/10,s3,x11/9,s3,x13/12,pg/p,x15/9,s14,x4/6,pl/e,x9/2,s10,x1/10,s13,x8/6,s12,x2/0,pg/n,x12/5,pm/c,s4,x15/11,pg/e,x6/8,pa/l,x13/7,s5,x15/8,s1,x4/3,s9,x15/0,s10,x14/4,pd/b,x10/15,s8,x3/7,s6,x9/2,s7,x10/14,s8,x4/3,pl/j,x10/14,s15,x2/7,pe/o,x0/8,s9,x5/4,pb/a,x1/9,s15,x13/15,pl/o,x1/14,s6,x2/0,s4,x14/10,s6,x3/13,pj/e,x4/8,s2,x3/9,s14,x10/15,pp/i,s5,x12/13,pd/k,x11/1,pe/p,x7/13,pf/l,x8/12,pd/k,x9/4,pb/i,s11,x3/7,s4,x1/10,s10,x14/3,pk/e,x5/7,s6,po/m,s11,pj/i,s10,x8/9,s6,pa/m,s13,x15/2,s11,x10/13,pc/p,x6/4,s11,pa/o,x2/5,s5,x14/11,pm/g,x9/5,pj/l,x12/0,s6,x5/8,s3,x1/14,s2,x8/7,pb/d,x13/4,s11,x2/0,pk/p,x14/5,s3,x10/4,pa/e,s15,x12/15,s10,x8/13,pb/d,x4/12,s3,x2/0,s5,x12/3,pi/k,x2/5,pe/b,x0/15,pi/d,x2/3,pf/k,x7/14,pl/m,x10/5,pp/f,x7/3,s9,pe/o,x5/1,pc/l,x7/0,s14,x15/4,s1,x11/13,s7,x10/15,pf/e,x12/2,s4,x15/5,pb/n,x3/6,s8,x8/7,s7,pi/m,s3,x11/5,s14,x9/14,s15,x0/13,pe/b,x2/14,s8,x4/15,s9,x9/8,s15,x12/5,s9,x9/6,s12,x10/1,pp/c,x15/8,ph/a,s13,x0/5,s14,x11/15,s6,x2/10,s11,x3/13,s11,x6/0,s3,x7/1,pj/n,x13/2,po/i,x4/1,s11,x14/2,ph/m,x10/6,pk/g,s1,x2/0,s11,x5/3,s10,ph/n,x0/14,s5,x6/15,pj/b,x13/8,s12,x12/7,s6,x10/0,s7,x3/11,s4,x7/0,pn/e,x3/1,s13,x15/13,s9,x2/4,s8,x9/15,pp/k,x14/5,s11,x8/9,s3,x11/13,s6,x9/1,pa/l,x10/4,pd/f,x1/13,s1,pb/m,x5/6,s4,x4/3,pe/h,x11/5,pc/j,x1/0,s12,x5/2,pd/e,x12/9,pg/h,x6/7,pf/b,s14,x9/13,s7,x7/5,pj/h,x9/11,s12,x1/13,pb/m,x6/11,s7,x9/10,s10,x7/1,s9,x3/2,pi/o,s7,x10/1,pj/n,x2/9,s2,x14/1,s5,x3/15,s11,x1/14,pg/k,x2/6,s13,x0/15,s3,x7/5,s3,x10/14,s13,pb/c,x6/8,s13,x2/15,s8,x6/13,s2,x11/3,s12,x2/12,s4,pe/k,x1/4,pc/d,x14/0,pf/p,x7/9,s5,x11/6,pg/l,x12/1,s13,x6/4,pi/h,x13/7,pk/o,x9/11,pm/n,x12/10,s4,x2/5,pk/h,x4/1,s2,x0/9,pj/p,x10/1,pi/b,x6/12,po/n,s8,x9/4,pg/p,x0/12,s3,x11/2,ph/a,x7/4,s1,x8/14,s4,x6/13,s2,x14/1,s6,x5/2,s9,x1/4,pc/l,x3/6,pa/b,s14,po/g,x1/9,pn/c,s3,x11/15,pd/g,x14/12,s14,x13/7,pf/i,x0/6,pd/m,x1/5,s11,x7/8,pg/f,x1/3,s12,x14/5,s14,x0/15,s11,x2/1,s8,x8/13,pe/c,x15/4,pk/h,x2/1,s8,x6/5,s8,x3/13,s13,x11/4,s5,x3/7,pa/p,x6/1,ph/k,s4,x4/11,s4,x3/10,pa/o,x0/1,s7,x13/6,s9,x11/4,s14,x1/12,s3,x6/10,s4,x4/15,s4,pi/m,x13/1,s3,x12/8,s15,pa/f,x11/4,s3,x1/2,s2,x8/15,s15,x6/7,s9,x14/13,s2,ph/l,x9/2,pb/a,x1/10,pl/d,x13/4,pg/p,s10,x9/1,pa/k,x11/7,s5,x5/15,pm/i,x1/8,s7,x4/11,s9,x9/6,pp/k,x2/14,s13,x0/12,s8,x3/2,pj/c,x10/8,pb/f,x2/4,s4,x11/12,pd/c,x4/8,s11,x5/3,s10,x1/8,s14,x9/10,s12,x2/14,s11,x4/15,pk/i,x3/6,pc/h,x0/11,pl/a,x1/10,pc/h,x9/8,pi/f,x1/2,po/p,x13/5,s14,x12/14,s12,pf/m,x7/11,s3,x5/9,s6,x13/7,s1,x12/9,s15,x6/10,pe/l,x5/15,s13,x10/13,s3,x1/0,s7,x4/15,s7,x13/2,s5,ph/c,s10,x7/11,s11,x15/5,s8,x12/3,pd/l,x8/10,pp/h,x13/11,pi/m,x6/10,pp/l,x15/2,s7,x9/1,s1,x15/6,pb/a,x2/9,s7,x11/7,s4,x14/1,s7,x10/11,po/k,x8/0,pc/m,x9/5,pd/a,x11/7,pl/h,x13/9,pi/c,x6/1,pk/a,x2/12,s9,x0/13,s2,x12/8,pm/c,s15,pf/j,s14,ph/l,x4/3,pn/p,x13/2,s2,x10/14,pf/h,x1/9,pg/l,x7/14,s4,x3/8,s7,x5/12,pc/f,s10,x7/9,s10,x4/15,s9,x8/9,s1,x7/6,s6,x4/5,pn/e,x8/3,pd/i,x12/4,pe/a,s1,x6/0,pb/d,x15/3,pj/p,x0/6,pb/m,x5/10,pl/h,x12/15,po/g,x1/5,s14,x4/15,s14,x9/7,s8,x0/3,s9,x12/10,s8,pd/e,x15/14,s5,x11/10,pb/i,x14/4,s13,x1/6,s12,x11/13,pc/p,x14/7,s15,x10/8,ph/l,x1/15,pg/d,x8/11,s15,pl/k,s10,x0/5,s2,x10/13,pa/p,x9/14,s8,x4/1,s5,x14/9,s2,x0/6,po/h,x9/2,pd/k,x4/13,pf/b,s13,x14/8,pc/i,s11,pn/d,s11,x15/1,s5,x6/13,s14,x1/4,pi/o,x6/15,pk/m,s4,x13/12,s10,x9/5,pn/b,x0/11,s6,x7/8,s15,x9/15,s5,x2/10,s14,x12/5,s8,x14/13,s5,pf/a,x2/15,pj/h,x8/3,pb/n,x1/13,s13,x4/15,s4,x13/1,pc/d,s10,x5/2,s4,x15/13,s7,x5/10,pa/n,x6/2,s1,po/f,x10/5,s7,x6/4,s13,x12/0,s9,x1/8,s5,x2/6,pc/h,x1/10,pe/o,s9,x11/6,s3,x8/14,s8,x4/11,pm/f,x7/0,pe/l,x5/2,s9,x11/12,pd/h,x8/4,s4,x11/3,pn/g,x9/12,s1,x3/14,pe/f,x1/11,pi/o,x0/4,s12,x2/6,s5,x4/11,s12,x0/13,pm/f,x3/7,pc/e,x15/8,pm/h,x10/0,s2,x7/2,s4,x10/4,s15,x7/2,s11,x4/3,pj/n,x6/12,s4,x10/0,pp/f,x11/1,s5,x10/12,s13,x13/14,pi/b,s12,x4/15,ph/j,x12/10,s1,x11/1,s1,x6/13,s13,x5/3,s4,po/k,x4/10,s9,x13/1,s8,x5/0,s5,pb/l,x2/3,s6,x12/9,s2,x5/13,pm/d,x6/15,s3,x14/3,pc/k,x4/0,s14,x8/12,s3,x11/0,pm/j,s6,x15/1,pn/e,x3/14,s2,x1/0,s4,x8/3,s6,x0/11,s8,x1/15,s8,x7/12,s14,x15/8,pa/f,s2,x5/12,s11,x6/11,pl/c,x12/8,pk/n,x7/10,s14,x12/3,s8,pg/b,x15/9,pf/a,x8/6,s5,x10/1,pd/k,s14,x11/6,s3,x13/15,pj/h,x1/9,pk/g,x7/15,pl/h,x9/3,s6,x12/2,s3,x3/4,s9,x11/1,s4,po/d,x4/9,s15,x12/8,pa/j,x1/9,s8,x7/2,s10,x11/6,pe/n,x3/4,po/m,x13/8,pc/j,x3/14,s14,x11/6,s2,x4/0,pb/k,x11/15,s11,x6/5,s12,x8/3,s13,x0/7,ph/j,x9/12,s4,x1/8,pd/l,x0/10,ph/p,x11/13,s3,x15/4,s11,pc/g,x1/3,pd/i,x5/15,s10,x4/2,s11,x6/10,s3,x3/1,s8,x2/0,s6,x3/7,pe/a,x2/8,pk/f,x13/12,s15,x4/11,s9,pa/h,x0/1,pg/d,x9/8,s10,x2/6,s1,pm/p,x10/12,s2,x11/9,s1,x8/15,pj/c,x10/0,pg/l,x9/7,s7,pa/m,x15/12,pb/l,x10/13,s14,x3/1,s7,x9/0,s5,x4/2,pf/d,x10/11,pp/c,x0/9,s2,x1/4,pj/m,x15/13,pf/e,x8/14,pg/m,s14,x4/15,s15,x12/10,s6,x14/9,s3,x6/13,s1,x4/5,s14,x2/12,pf/j,x3/9,s8,pg/d,x1/4,pi/e,x10/9,s10,x7/14,pa/n,x12/1,pc/p,x0/9,s9,x2/4,s5,x9/13,s11,x8/10,s8,x15/4,pi/l,x2/11,pm/e,x4/0,s6,x2/7,s8,pi/n,s14,x12/6,s1,x5/4,s6,x7/12,po/h,x3/2,s12,x12/6,s15,x5/4,s4,x9/7,s3,x3/13,s7,x14/8,pj/l,x2/6,pa/m,x8/10,s14,x13/6,s7,x15/4,pe/j,x9/6,s2,x5/15,pm/b,x12/10,s14,x7/6,s11,x5/11,po/g,x2/6,s7,x0/14,s7,x2/15,s4,x7/3,pp/j,x8/11,s13,x0/3,s15,pd/h,x14/9,s4,pg/e,x15/2,s9,x13/5,s9,pi/j,x7/0,s10,pd/e,x5/1,po/a,x6/13,pd/h,s11,x15/8,s1,x14/3,s12,pc/m,x7/1,pp/o,x15/8,pa/j,x5/10,s12,x12/4,s10,x3/11,s15,x14/0,pe/p,x5/9,s3,x4/7,s11,x11/15,ph/f,x2/5,pa/k,x6/4,s13,x11/10,s9,x4/3,s8,x15/1,s6,ph/g,x14/5,s12,x6/13,s14,x5/9,s9,x13/2,s12,x7/10,s1,x14/4,pk/o,x6/11,s15,x7/14,pm/b,x8/5,pe/l,x10/4,s14,x5/1,pk/b,x10/2,s15,x3/9,pc/m,x2/15,pg/j,s7,x12/3,s12,x5/11,pl/c,x14/2,s3,x1/7,s2,x4/14,s9,x7/3,s3,x8/14,s1,x6/10,pn/f,x14/5,s13,x12/6,s9,x2/5,s4,x9/1,s4,x12/5,pk/j,s12,x6/11,s9,x0/8,s1,x7/12,s3,x5/2,s12,x9/15,ph/l,x12/4,s14,x15/11,s15,x7/13,s5,x4/1,pm/f,x6/5,s9,x9/15,s13,x3/11,po/j,s5,x14/2,pg/b,x4/3,pa/m,x10/5,pc/i,x11/1,s14,x7/8,pl/f,x2/11,s9,x13/12,pp/i,s14,x2/5,s2,x7/3,s8,x2/8,s8,x6/1,s2,x10/11,s6,x12/7,s1,x1/6,pl/a,x3/8,s3,x7/13,s14,x14/9,s4,x11/3,pd/h,s6,x8/9,s14,x2/14,s9,pk/a,s7,x10/8,s12,x6/2,pf/h,s6,x13/4,s5,x6/2,s4,x5/13,s2,x2/10,pk/j,x4/6,pf/h,x9/10,pc/j,x3/14,pg/f,s14,x11/12,s4,x2/6,s9,x10/8,s8,x12/15,s13,pe/b,x4/3,s4,x11/1,s7,x12/9,pf/i,x1/11,pl/a,x3/6,s3,x12/10,s12,x3/2,pg/d,s6,x13/14,pm/i,x0/12,pa/e,x10/15,s1,x9/5,pm/i,x2/7,pk/h,x10/0,pn/b,x1/2,s2,x4/15,pi/g,x7/12,pd/k,x4/3,pm/n,x2/12,s3,x3/11,s13,x0/4,s1,x2/1,s5,x15/6,s5,x13/10,s2,x14/9,ph/b,x15/2,pd/e,x7/10,s12,x0/12,pi/a,x13/9,pg/e,x11/7,pn/b,s1,x9/12,s10,pc/o,x1/0,pb/a,x2/12,pd/e,x7/8,s5,x3/9,s13,x6/5,s15,x8/12,pp/b,x2/5,s14,x9/14,s1,x1/13,s14,x14/6,pe/a,s7,x13/2,s13,x10/14,s1,x13/4,s9,x1/15,s13,x2/9,s13,x4/0,s4,x13/3,pd/h,x8/10,s3,x0/15,s4,pa/m,s15,x2/11,s8,x10/3,s13,x1/13,s2,x9/4,s13,x2/13,s15,x6/10,pi/f,x8/1,s6,x10/5,pn/b,x11/7,pk/a,x14/9,s1,x11/6,pn/p,x12/9,s7,x10/15,pg/f,x13/14,s12,x6/2,po/p,x9/8,s13,pl/e,s7,x0/13,s1,x10/12,s3,x11/8,s9,x12/13,pn/a,x5/3,ph/k,x11/9,pi/o,x1/14,pb/j,s1,x7/6,po/d,x9/13,s1,x15/0,s13,x3/11,s4,x6/12,s10,x11/0,s4,x4/7,pg/a,x5/0,s13,po/h,x9/10,s11,x5/3,s13,x0/2,s13,x15/14,s2,x7/11,s12,x8/9,pm/a,x5/10,s12,pn/p,x6/3,s15,x7/10,s15,x11/6,pk/g,x7/14,s14,x3/1,s1,x5/10,pf/o,s13,x7/9,s1,x12/6,s4,x13/7,s11,x9/1,s13,x5/7,s1,x8/14,pj/p,x11/15,pn/f,s10,x14/2,s14,x13/12,s1,x6/15,pc/i,s14,x7/11,s12,x2/1,s1,x14/7,s2,x1/10,pb/o,x3/2,s10,x11/4,pf/h,x6/5,s2,pl/n,s7,x0/14,s12,x10/13,po/j,x7/1,pp/h,x10/13,pn/m,x0/9,pb/i,x14/1,s11,x5/7,pg/h,x14/1,s14,x4/5,s14,x14/15,s11,x5/9,s8,x12/4,s13,x13/5,pf/b,x8/7,s11,x2/9,s14,pj/o,x4/0,s15,pm/f,x11/9,pc/i,x7/14,s4,pf/l,x9/11,s2,x6/15,s5,x11/2,s8,x10/3,s9,x6/9,s9,x2/14,pe/b,s12,x11/5,s11,x4/1,pd/h,x13/14,pi/f,s10,x12/9,pg/m,x4/13,s3,x11/1,pi/b,x0/8,s11,x3/9,pl/p,x2/6,s11,x4/11,s10,x1/12,ph/n,s11,x9/15,pg/b,x3/8,s5,x14/15,s2,x5/12,pa/f,x8/15,s9,po/m,x3/9,s10,x14/11,s13,x4/6,pi/c,x15/9,s5,x7/4,s6,x2/1,s5,po/b,x4/8,s6,x12/5,s11,x1/7,s2,x13/5,pj/c,x8/9,s5,x11/3,pb/n,x15/13,pe/g,x10/1,s10,pl/d,x0/11,pj/k,x6/12,s11,x13/14,s15,x2/9,s6,x0/11,s15,x10/8,s3,x5/2,s9,x10/1,pe/h,x14/4,po/p,x13/6,s4,x7/4,pl/a,x0/1,s7,x13/11,s8,x0/1,s2,x10/6,s3,pn/c,s8,x1/8,pd/k,x15/4,s1,x3/5,s12,x12/2,pb/h,x8/10,s4,x11/12,s6,x13/15,pn/o,x0/2,s12,x1/6,s9,x14/9,s5,x11/13,s10,x4/15,s4,x11/1,s9,x14/15,s11,pj/p,x11/3,s2,x12/1,s1,x14/4,po/h,s12,x9/1,pb/j,x14/0,pk/c,s1,x13/2,s14,x15/5,s13,x10/9,pa/h,x14/1,pc/j,x6/3,s2,x15/10,pl/b,x6/1,po/p,s3,x9/10,pl/a,x12/0,s2,x2/1,s13,x10/15,s6,x14/5,s3,x7/3,s2,x10/4,s5,pj/c,x8/13,s1,pi/g,s11,x14/7,pk/h,x15/1,s14,x11/9,s7,x12/2,s3,x8/3,s12,x12/10,s14,x14/4,s6,pc/b,x1/6,s4,pa/h,x0/10,s9,x12/9,s13,x8/0,pd/p,x3/2,s11,x15/13,po/g,x10/1,s5,x4/8,pf/j,x5/10,pg/c,x2/11,pn/j,x10/1,s15,x7/9,s6,x11/1,s9,x6/3,s7,x0/15,pi/b,x6/8,s8,x1/15,s2,x13/6,s3,x4/10,s9,x0/7,pj/d,x8/11,s3,x1/9,s6,x14/11,pg/f,x10/3,s14,x5/11,s13,x14/3,pl/m,x7/12,pk/g,x11/14,s12,x5/4,s4,x12/13,pa/b,x6/7,pp/f,x13/11,s3,x4/14,s10,pg/e,x3/8,s4,x0/15,s15,x4/2,s7,x15/12,pp/j,x3/13,pb/o,x8/4,s14,x12/2,pj/l,x1/6,po/g,x12/8,pb/n,x10/13,ph/a,x4/0,pd/b,x15/5,pm/a,x8/14,s2,x12/2,s2,x7/9,s5,x12/6,pl/g,x3/13,s1,po/d,x14/1,pn/b,x10/12,po/g,x0/11,s10,x7/12,pl/a,x15/6,s4,x2/7,s8,pb/e,x9/3,s2,x7/12,s4,x9/6,s10,x11/2,s15,x1/3,s4,x8/0,pk/l,x4/7,s1,x1/14,pi/c,x13/9,pm/k,x8/14,pf/o,x13/9,s7,x0/8,pj/c,x14/6,s4,x11/15,po/p,x9/1,s12,x4/10,s1,x14/5,s9,x12/10,s14,x8/9,pm/c,x5/4,pl/p,x2/6,s15,x11/15,pg/d,s15,x2/8,pk/f,x1/12,pi/g,x0/10,s12,x3/5,s10,pa/k,x15/1,s3,x4/3,s3,x10/5,s11,x3/4,s13,x5/0,pe/i,x4/2,ph/p,x11/3,pn/c,x5/10,pa/h,x15/9,pc/m,x4/14,pg/e,x15/0,pc/d,s13,x1/13,s6,x0/11,pl/i,x8/2,s10,x14/11,s4,x0/2,s1,x10/15,s14,x7/6,s7,x11/9,pc/p,x3/0,pf/o,x13/15,s5,pp/i,x3/11,s12,x7/5,pl/k,s2,x4/3,pd/c,x12/14,pl/f,x8/0,s7,pd/h,x7/5,pj/l,x10/14,s15,x6/15,s14,x0/3,pa/p,x14/12,s15,x5/1,pk/l,x8/2,s6,x0/12,s5,x13/4,pp/e,x14/1,s2,x2/12,pa/l,x11/9,s4,x10/7,s6,x2/8,s9,x7/0,s2,x5/2,ph/j,x11/12,s15,x9/2,pn/d,x8/10,s8,x9/15,s7,x14/13,pj/f,x11/3,s14,x14/2,pe/c,x13/4,pd/b,x8/0,s4,x2/13,s3,x4/9,s5,x8/10,s8,x14/5,pf/m,x15/7,s14,x10/4,s14,x0/13,s9,x8/5,pk/n,x13/7,s1,x12/5,pl/i,x0/1,s13,x3/12,pa/m,x9/15,pb/o,s6,x0/11,pe/d,x4/1,pk/p,s12,x7/14,s8,pl/o,x5/9,s4,x0/15,s6,x12/9,pj/f,x1/13,pi/a,x7/9,pj/n,x5/1,pp/m,x6/10,po/d,x15/2,pn/e,x13/6,s10,x8/12,pm/i,x1/10,s5,x8/11,s5,x5/1,s12,x10/0,s11,x12/11,pc/h,x9/1,s5,x10/13,pd/p,x4/2,pa/j,x7/15,s6,x12/10,s9,x6/4,pg/f,x11/10,s4,po/l,x8/5,pp/d,x9/3,s13,x6/5,s2,x0/14,s6,x11/13,s7,x6/7,s8,x5/11,pa/o,s6,x0/13,pp/d,x1/10,s3,x2/7,s4,x15/1,pf/j,x3/7,pm/o,x5/6,pp/k,x14/10,s11,x15/5,s14,x7/1,s8,x14/5,po/d,s1,x8/6,s11,x4/13,s13,x2/12,s2,pb/g,x11/6,pk/m,s8,x5/0,s11,pg/o,s4,x15/12,s4,x7/4,s5,x12/8,s12,x14/2,s3,x7/3,s8,x8/1,s15,x3/15,s12,x13/8,s1,x15/5,s9,x13/10,s10,x1/15,s2,x4/6,ph/m,s10,x2/5,pn/c,x15/7,pj/k,x9/14,pf/b,x5/4,s5,pi/h,x8/11,s5,pm/o,s7,x4/2,pp/f,x11/0,s13,pa/n,x7/15,s13,x1/10,s4,pk/f,x7/4,pg/d,s13,x0/9,pb/i,x10/5,pp/h,x7/0,pd/j,x15/9,s3,x4/10,s2,pe/m,x14/9,pl/h,x7/2,s5,x6/14,s3,x4/1,s13,x9/3,po/d,x1/8,s5,x9/2,pa/g,s11,x14/5,s6,x3/1,pc/k,x13/9,s7,x8/3,s13,x10/2,s9,x5/6,s8,x15/9,pi/e,s3,x10/13,po/f,x7/12,s11,x13/15,pb/d,x5/14,s1,x1/9,s11,x6/7,pc/l,x3/5,ph/m,x8/1,pl/g,x9/5,s7,x11/13,pd/h,x12/6,pg/f,x13/9,s12,x12/0,pc/i,s4,x8/5,pb/f,x1/6,s15,x14/3,pn/e,x11/10,pk/f,x5/9,s12,x11/15,pd/l,s15,x9/2,s1,x15/8,pj/b,x13/7,s14,x15/0,s14,x5/9,s15,x11/6,pd/e,s2,pm/o,x0/7,s15,x15/6,ph/l,x14/5,po/p,x1/8,pf/n,x11/14,po/c,x10/12,s15,x15/4,s6,x9/11,pn/h,x13/3,pi/l,x8/9,s13,x15/0,s11,pf/o,x13/3,pk/j,x2/12,pg/f,s8,x8/10,s7,pi/j,x5/11,s13,x3/12,pc/e,x13/4,s2,x10/2,pp/a,x6/14,pi/c,x0/5,s3,pk/g,x11/1,pd/e,x14/5,pi/c,x0/12,pk/l,x11/4,pp/e,x12/13,s2,x8/5,s12,x1/9,s15,x8/4,s2,x3/12,s11,x10/8,pj/o,x3/7,s5,x11/15,s4,x6/7,s7,x15/1,s2,x4/11,s5,x0/15,s13,x6/5,pm/h,x1/0,pc/i,x8/7,ph/m,x15/11,s12,x0/12,pe/d,x14/5,s5,x4/3,s2,x1/2,pl/g,x14/10,pa/c,x4/12,s5,x15/7,pg/p,x0/14,pi/f,x3/12,pj/o,x11/13,s3,x2/10,pa/l,x6/9,s5,x14/1,pb/h,x6/11,s8,x1/13,s8,x15/7,pg/n,s14,po/i,x9/3,pa/n,x0/4,s2,x2/13,pf/l,x4/15,pd/b,x3/0,s10,x15/11,s10,x7/5,pf/l,x13/14,s5,pm/g,x2/7,pc/h,x4/5,s14,x14/10,s7,x5/8,s3,x0/4,s7,x6/5,s3,x4/3,pd/i,x1/8,pn/f,s10,x12/11,s2,x4/7,s11,x8/11,s8,x6/7,pp/b,x15/8,s5,x9/14,s2,x13/10,s6,x15/5,pk/d,x6/8,pf/o,x0/13,s3,x4/8,pa/i,x1/3,pk/n,x15/9,s10,x1/0,s8,x8/10,pp/f,x6/14,s7,x12/13,s4,x11/0,pb/a,x2/12,s1,x10/5,pm/p,x7/4,s4,x11/0,ph/g,s5,x6/14,s1,x1/12,pa/e,x7/8,pi/b,x14/6,pk/e,s7,x10/11,s3,x5/3,s1,x2/6,s1,x12/4,s12,x3/1,s11,pa/j,x14/0,s2,x11/15,s14,x12/5,pl/d,x10/1,s6,x8/15,s4,x14/12,s1,x4/7,s1,x1/14,s10,x9/8,pi/b,x0/4,s13,x2/9,s6,x5/4,pa/f,x7/6,pm/k,x10/8,pj/n,x9/6,s11,x4/0,po/l,x14/15,s12,x3/7,pj/m,x15/0,pi/e,x8/4,s15,x13/15,pb/p,x0/4,po/g,x14/9,s2,x1/10,pb/p,x3/6,s5,x0/11,s5,x9/12,s2,x1/13,pd/a,x6/5,s13,x8/11,s13,x6/9,s2,pk/h,x3/15,s10,x11/7,s14,x12/5,pa/n,x3/9,s8,x12/7,s8,x13/4,s15,x1/2,ph/l,x0/7,s6,x3/1,pn/f,s2,x13/2,s14,x15/10,s6,x7/11,pi/m,x0/12,s12,x3/13,pp/f,s15,x15/9,s5,x5/4,s8,x10/0,s9,x6/4,pk/n,x13/0,pf/g,x12/2,pc/m,x10/15,s9,x14/4,s2,x8/9,s6,x11/3,s2,pg/p,x4/14,pm/k,s8,x13/6,pc/h,x5/8,s11,x6/9,pj/m,s7,x0/14,pg/o,x11/8,s10,x15/6,s14,x7/12,s3,x11/6,s4,x3/14,s14,x6/1,pa/n,x5/15,s1,x11/9,s14,x10/14,s6,x13/4,pi/g,x15/5,s12,x0/8,s5,x1/14,pn/f,x8/3,s9,x13/11,s14,x6/0,po/d,x7/11,pb/g,x1/12,s1,x6/5,s4,x1/3,s10,x7/8,pi/m,s5,x2/4,pg/c,x5/9,pf/e,x2/14,ph/o,s5,x7/3,pg/a,x13/9,pm/b,s10,x1/15,s2,x8/2,pe/h,x0/1,pj/n,x8/5,s15,x12/9,pp/f,x6/7,pi/d,x11/0,pk/o,s14,pe/m,x6/15,s8,x3/1,pd/f,x13/9,pj/c,x0/2,s14,x4/10,po/p,x12/0,pd/a,s2,x11/7,s2,x1/2,s3,x7/8,pj/c,x9/1,pp/d,s9,x13/8,pj/b,x12/0,pc/n,x14/11,s4,x2/5,po/b,x7/11,pf/h,x0/10,pa/k,x7/15,s15,x14/0,s10,x10/7,s10,pe/f,x2/6,pp/d,s7,x15/14,po/f,x5/1,pm/p,x11/8,pl/o,s8,x9/7,pm/f,x6/4,pe/n,s2,x8/15,s12,ph/m,x13/5,pl/a,x11/7,pb/g,x0/14,s5,x15/10,s7,po/n,s9,x7/6,pd/l,x2/8,s11,x5/14,s7,x3/12,s11,x0/4,s13,x15/5,pe/g,s2,pn/a,x1/7,pi/m,x2/3,s14,x14/13,s13,x7/5,pp/e,x1/12,pj/c,x2/8,pb/a,x6/7,s2,x1/5,s6,x10/8,s4,x2/11,pf/k,x14/12,s5,x0/11,s13,x15/6,s8,x5/1,pb/h,x13/14,pe/k,x2/3,s5,x7/14,pa/d,x1/5,pm/n,x13/3,s4,x10/1,s13,x8/15,s11,x10/7,po/a,s1,x14/5,pl/n,x13/4,pm/e,x5/3,s13,x0/2,pp/c,x5/14,pl/b,x10/2,s1,x14/5,pk/i,x10/7,pe/n,x6/3,pp/j,x7/0,s10,x11/2,s1,x9/1,s4,x7/15,s6,x5/4,s10,x0/1,s5,x5/3,pc/o,x14/8,s7,x15/6,s15,x2/4,s5,x7/9,s14,x15/5,pp/b,x3/0,s11,x13/1,s5,x4/10,s10,x1/9,s13,x6/0,s3,x3/9,s1,x2/12,s7,x5/1,s1,x0/6,s11,x11/2,s4,x5/7,pc/j,x6/15,pi/n,x11/3,pa/c,x2/15,pb/m,x9/0,s8,pn/p,s9,x8/6,s10,ph/c,x4/11,pf/i,x14/0,s4,x8/3,pe/g,x7/2,s8,x8/10,pd/f,x2/5,s13,x10/12,pn/e,s10,x9/6,s13,pl/i,x8/7,pp/o,x4/5,pm/b,x7/9,pf/h,x0/12,pm/n,x4/13,s4,x9/7,s4,x4/10,s13,x0/14,pk/j,x13/12,s4,x2/14,s14,x8/13,s13,pa/g,x6/5,pm/b,s9,x0/10,s13,x9/7,s1,x1/12,s14,x3/11,ph/f,x2/13,pn/g,x11/1,s5,x7/6,pi/b,x3/0,s12,x12/2,pp/e,s8,x11/15,pn/o,s9,x7/4,s2,x14/6,pm/k,x12/11,pn/i,x1/6,s8,x2/14,s10,x9/15,po/p,x12/2,s15,x8/5,s10,x3/7,s14,x14/2,s5,x12/7,pf/n,x14/13,pe/h,x2/11,s6,x10/0,s2,x1/11,s1,x4/7,pa/n,x12/9,pk/e,s1,x10/13,ph/l,x6/2,pp/n,x13/0,s1,x7/4,s8,x9/0,s7,x7/13,pb/c,s8,x11/9,s8,x10/3,pp/a,x6/13,pc/e,s12,x12/11,pi/g,x9/14,s11,x12/3,po/b,x6/13,s1,x14/1,s14,x9/6,pj/f,x0/7,s11,x2/9,s15,x11/3,pb/d,x1/6,s4,x9/3,pf/g,s13,x4/14,pl/a,x10/5,s3,x11/1,pn/g,s4,x3/6,pa/i,x15/2,s3,x4/0,pn/k,x1/12,s12,x2/4,pa/d,x12/0,s11,x3/4,po/b,x5/12,pf/n,x11/4,s11,x3/1,pc/b,x9/7,s4,x14/13,s14,x11/15,s8,x2/8,pg/a,x6/3,s13,x8/5,s8,po/f,x3/6,s12,x11/4,s1,x8/13,pl/j,x14/2,s3,x5/13,s2,x1/15,pm/k,x7/3,s14,x15/2,pc/i,s5,x12/6,s1,x11/13,s12,pp/m,x3/10,pn/g,s13,x9/7,s6,x4/14,pf/l,x15/2,pd/m,x6/0,s6,pn/h,x3/2,s8,x4/13,s1,x1/9,s8,x6/8,pm/e,x14/4,s8,po/a,x1/7,s11,x4/8,s15,x3/9,s1,x2/10,pn/l,x7/4,ph/k,x14/6,s1,x4/8,s13,x1/0,pj/o,x11/2,pd/n,x3/12,s4,x7/8,s4,x14/10,s3,x11/15,s5,x0/2,s4,x15/11,s9,x9/10,s13,x4/0,pa/g,s4,x8/6,s12,ph/i,s1,x3/7,s3,x5/13,s1,x0/12,s10,x8/15,pp/g,x5/4,s15,x0/1,pf/c,x13/10,s14,x12/8,pp/h,s8,x14/13,s15,x8/4,s8,x6/1,s4,x8/3,pc/j,s13,x12/9,pi/o,x1/5,pg/n,x13/10,s10,x2/8,s12,pl/o,s6,x7/15,s4,pa/m,x0/9,s2,x8/13,s4,x15/5,pe/f,x1/13,pp/n,x12/14,pj/f,x9/4,s11,x14/7,pm/b,x6/1,pn/i,x3/11,pl/h,s1,x8/14,s8,x0/10,pa/c,x12/7,s6,x4/0,pp/b,x10/11,s5,x9/5,pm/i,x4/7,pl/d,s2,x12/5,s13,x4/2,s10,x11/7,s13,x15/9,pi/n,x5/14,ph/a,s4,x0/13,s5,x3/12,s11,x9/1,s4,x5/14,pb/n,x10/9,s5,x1/13,pc/m,x0/15,pa/j,x13/9,s7,x12/0,pn/b,x3/4,s1,x6/9,s8,x12/2,s12,x0/9,pe/k,x1/7,s4,x3/8,pc/h,x7/11,s11,x14/13,s10,x15/6,pf/o,x10/3,pg/e,x5/6,pf/n,s5,x0/1,s9,x3/15,pd/j,x9/1,pp/a,x8/7,s1,x2/15,pn/h,x13/4,s6,x15/0,s11,x14/3,s14,x9/0,s7,x5/3,s6,x15/9,s4,x2/12,s5,x4/0,s12,x5/12,s9,x2/7,pc/i,x3/4,pd/p,x7/5,s13,x10/3,s12,x15/7,pa/b,s9,x6/10,s14,x3/12,pe/c,x0/1,po/b,x9/15,s12,x7/13,pk/a,x11/10,s8,x4/12,po/f,x9/14,s15,x11/13,s4,x15/2,ph/a,x9/4,s13,x13/8,pm/l,x14/2,s14,x9/10,s10,x12/1,ph/c,x3/13,pp/b,x12/5,s11,x8/15,pa/l,x1/14,pk/b,x8/11,pj/f,x0/2,s12,x6/9,pa/o,x10/7,s14,pk/d,x2/6,s4,x9/11,s13,x1/3,s6,x14/7,s9,x15/9,s2,pl/n,s13,x6/2,s12,x4/0,pf/a,x11/9,s3,x8/15,s14,x14/4,s6,x0/11,s1,x8/12,pp/h,x5/3,s14,pj/c,x6/10,s9,x13/8,pk/o,x14/12,pn/l,x7/13,pp/f,x5/8,pe/a,x1/2,po/j,x5/12,s11,x4/0,s6,x15/8,s15,x10/7,s8,x11/6,s5,x12/15,s6,x4/2,s1,x7/15,s10,x12/14,s7,x5/13,s1,x3/2,s13,x1/4,s5,x9/2,pc/d,x3/13,s10,x7/15,s1,x8/14,pf/l,x15/5,pe/h,x14/12,s7,x10/3,pg/m,x6/11,ph/o,s11,pp/n,x7/14,pm/g,x12/0,s13,pn/d,x13/1,s7,pk/e,x6/10,s10,x0/4,pf/m,x11/3,s11,pj/n,x10/13,s15,x9/12,pa/o,x4/5,s5,pf/p,x11/6,s14,x14/13,s10,x15/0,s15,x13/5,s9,x2/7,s4,pm/k,x11/10,s7,x12/8,s12,x15/1,s13,x4/0,s6,x5/12,s6,x10/6,s7,x1/12,pa/g,x0/5,pn/m,x13/12,s15,x2/10,s13,x3/14,s5,x6/5,s10,x10/0,pd/o,x6/14,pe/b,x12/15,pk/d,x4/5,s11,x13/10,s13,x1/7,s2,x12/6,s2,x4/3,s7,x12/15,s14,x9/1,s7,x12/5,pi/a,x13/15,s6,x9/14,pe/g,x8/12,s15,x15/13,s15,x5/2,s9,x3/12,pm/c,x14/15,s8,pn/b,s15,x11/9,s3,x2/12,pk/o,x1/11,pj/e,x14/13,s14,x2/10,po/k,x12/7,s4,x9/1,pf/c,x6/10,pn/g,x5/12,s9,x9/10,s15,ph/o,x8/14,s13,x9/7,pm/f,x2/4,s1,x8/7,s11,x6/2,s13,x12/15,s2,x8/3,s4,x15/9,pk/b,x3/8,s10,x14/0,pg/a,x2/12,s12,x10/11,pp/b,x14/2,s8,x1/0,s2,x15/8,s3,x14/7,s8,x8/6,s12,x1/3,s10,x10/13,s12,x3/2,s4,x8/12,pm/f,x11/13,pi/p,x9/15,pn/f,x10/7,pg/j,x8/1,s4,x12/0,pa/f,x14/8,pp/n,x7/4,pm/f,x5/13,s12,x9/15,po/a,x6/8,s3,x0/11,s6,x9/1,pj/f,s8,x13/5,pg/h,x9/11,s6,x3/7,s13,x11/0,s9,x13/9,s1,x7/6,s6,x0/4,pc/p,x12/9,s6,pm/n,s8,x0/2,pc/f,x9/11,s12,x6/5,pe/n,x10/8,s5,pg/f,x2/6,s5,x4/7,pc/a,x5/8,s13,x2/15,s15,x12/9,pf/d,x2/8,s13,pe/n,x5/3,pc/d,x6/8,po/m,x2/13,pj/n,x14/4,s8,x12/9,pk/f,x14/11,s9,x12/10,pc/a,x7/8,s1,x10/1,pb/n,x4/3,pm/g,x5/0,s4,pk/o,x2/1,s4,x9/15,s5,x7/0,pe/d,x8/9,pp/j,s8,pc/l,x5/15,pg/o,x8/3,s9,x10/9,s13,x5/14,pn/k,s4,x6/9,s9,x1/2,ph/i,s8,x9/7,s4,x4/12,pb/j,x5/1,s7,x0/12,pi/f,s11,x3/14,s1,x15/12,pa/p,x5/10,s12,x8/7,pf/e,s13,x12/1,pj/d,x3/2,s13,x15/0,pe/m,x4/7,s13,pg/a,s4,x9/14,s2,x15/8,ph/f,x12/5,pk/p,x1/13,pb/i,x7/9,pd/a,x0/8,s2,x6/2,pi/n,x4/11,s12,x1/6,s1,x12/13,ph/c,x15/9,s15,x4/6,pl/e,x3/11,s5,pg/j,x7/1,pm/k,x11/2,s4,x9/15,s7,x4/12,pl/g,x15/14,s6,x2/0,s1,x11/14,s8,x8/1,pm/a,x7/14,pn/e,x9/1,s14,x11/12,pf/g,x5/9,s4,x8/15,s6,pm/k,x9/0,s10,x8/11,s13,x13/2,pa/j,x7/10,s15,pk/e,x12/14,pi/n,s6,po/b,x6/7,pm/i,s15,x15/8,s12,x11/1,s13,x12/14,pb/o,x3/11,s14,x0/6,s13,x5/3,s11,x10/8,s10,x11/1,pk/m,s5,x5/2,s9,x9/10,pp/i,s14,pc/o,x15/2,s7,x10/5,s9,x13/11,s12,x1/6,s15,x8/15,s10,x11/1,pj/f,s6,x0/14,pc/g,x9/13,pl/k,x7/14,s4,x4/13,pe/n,x3/14,s2,x5/4,pa/b,x7/6,s8,x1/8,pn/c,x13/14,pe/f,s6,x6/15,pd/h,x11/7,s3,x8/4,s8,x5/2,s3,x1/3,s12,x10/5,s5,x13/1,s5,x4/0,s12,x11/15,s7,x6/0,s10,x5/1,s12,x0/12,s14,x11/9,pp/m,x6/14,s7,x11/4,s6,x3/12,s12,pi/g,x5/9,s15,x13/1,s3,pa/m,x15/7,s15,pc/e,x3/9,s8,x14/10,s12,x9/4,pi/d,x6/3,pm/f,x1/8,s12,x12/13,pe/h,x8/10,pa/d,x13/3,pf/n,x7/9,s12,x14/5,pk/e,x4/13,s14,x7/8,s10,x14/10,pj/i,x0/2,s4,x15/8,s15,x7/5,s4,x8/13,ph/a,x4/7,po/n,x2/13,s12,x6/10,pe/p,s6,x15/0,s10,x11/2,s13,x3/14,s4,x7/1,pg/f,x5/12,s6,pb/o,s2,x3/15,pm/e,x7/10,s3,x12/0,pb/g,x1/4,pp/d,x12/3,s15,x6/8,s13,x14/13,pm/b,x15/4,pi/c,s12,x6/5,s6,x8/15,pg/a,x12/3,pf/i,x13/14,s10,x5/2,pc/m,x3/8,pn/k,x13/9,s9,x15/14,pi/m,x9/1,s5,pn/g,x10/13,s6,x6/3,pl/h,x5/9,s4,x14/13,pc/e,x6/0,pf/o,x9/3,pl/k,x10/4,s4,x3/14,pi/c,x4/11,pk/n,x1/8,s5,x12/10,s15,x11/0,po/m,x4/3,pc/b,x7/2,s12,x14/9,s9,x0/1,s7,x15/2,s11,x13/4,s15,x0/5,s9,x12/10,s15,x6/14,s7,x12/3,s10,x10/11,s6,x12/15,s12,x2/1,s3,x12/11,s8,x2/13,pd/a,x14/11,pe/o,s8,x13/15,s4,x9/11,s15,x5/4,s7,x3/8,s3,x6/10,s6,x2/5,s13,x10/4,s10,x2/5,s5,x11/14,s11,x15/4,pc/j,x9/6,s6,x2/10,s12,x3/14,pd/o,x2/0,s10,x13/9,pe/g,x10/5,pk/i,x3/13,s7,x15/7,s1,x4/6,s9,x3/12,s15,x6/1,pg/d,x14/10,s1,x6/5,s1,x2/11,pl/m,x3/5,s6,x1/13,s8,x4/15,s15,x9/13,s15,x10/3,s8,x11/0,s9,x10/3,s2,x1/15,s9,pc/p,x8/9,pe/d,x6/13,s12,x14/4,s15,x12/1,ph/i,s10,x4/11,s13,x2/15,pd/j,x12/3,pe/h,x13/5,pm/c,x8/10,pf/o,x6/12,pa/h,x2/14,s3,x3/15,s9,pb/c,x14/6,s3,po/k,s6,x5/2,s9,x7/13,s12,x14/9,pj/h,x0/5,pk/l,x15/11,s2,x3/9,s4,pj/a,x1/5,s8,x2/7,pd/l,x5/0,s13,x14/8,pn/p,x12/3,pk/d,x14/1,pa/h,x4/7,pc/m,x3/9,po/a,x10/5,s13,x11/1,pm/g,x15/7,s6,x12/10,s7,x14/4,po/a,x2/0,s11,x4/11,pg/k,x1/7,s3,x10/0,s6,x14/7,s9,x12/11,pm/d,x5/4,pn/j,x6/13,s15,x15/1,pa/k,x8/4,pl/o,x14/15,pc/m,x10/4,s14,pj/f,x7/9,pd/a,x2/5,s15,x0/6,s11,x10/8,pg/k,x6/0,s11,x7/11,pa/l,x2/0,ph/o,x11/15,s4,x9/6,s1,pi/l,x4/10,pk/e,x8/9,s11,x13/2,s12,x8/11,s4,pc/o,x4/5,s4,x9/15,pi/b,x7/6,s8,x11/13,pf/e,x1/3,s1,x13/6,pd/j,x0/11,pp/c,s11,x15/13,s10,x2/5,s1,x11/1,s15,x9/5,pl/n,x10/6,s15,x8/4,s11,x9/13,s13,x10/5,s6,x12/1,s3,x4/15,s6,x13/11,s12,x5/14,pb/j,x9/13,s2,x7/15,s8,x3/1,pf/i,s3,x4/7,pd/n,x10/14,pi/p,x6/3,s14,x12/15,s8,x14/3,pc/e,x8/7,s6,x15/9,s1,ph/o,x6/4,s15,x13/12,s11,x2/8,s9,x0/9,s4,x6/14,pi/g,x5/12,s9,x11/0,s14,x14/2,s14,x6/0,s14,pf/b,x11/1,s4,x2/7,pi/m,x0/9,s7,x8/1,pg/l,x3/2,pd/f,x10/8,s6,x14/2,pe/o,x5/9,s11,x11/2,s9,x7/15,s6,x10/11,pf/k,x1/15,pj/g,x0/13,pl/m,x8/7,ph/g,x12/1,pn/f,x9/11,po/e,x15/0,pn/h,x3/13,s12,x9/2,pa/g,x5/1,po/i,x4/0,s8,x6/13,pk/p,x11/4,pg/l,x8/12,s1,x7/6,pe/a,x15/2,pp/h,x10/11,pk/g,s11,x3/9,s3,x14/10,s8,x9/5,po/f,x8/1,s13,x4/5,s10,x6/12,s6,x15/1,s6,x4/12,s3,x1/2,s8,x6/10,pb/i,x14/2,s13,x8/11,s6,x6/9,s11,x0/1,pn/c,x10/12,s14,x13/4,pe/o,x1/10,s10,x12/4,s14,x9/7,pc/m,x3/6,s5,x10/11,pg/k,x6/4,pc/p,x9/0,s7,x7/5,pj/e,x4/9,s11,x10/12,pk/f,x4/0,pe/d,x15/13,po/p,x11/3,pf/e,x6/0,pm/k,x13/5,po/h,x14/0,s7,x1/12,pa/f,x3/11,s9,x14/5,pi/h,x1/11,pg/b,x10/13,s5,x5/2,pc/m,x14/4,pl/e,x0/2,s8,x6/4,s14,x3/5,pj/g,x7/6,s8,x15/0,s6,x10/7,s9,x6/3,s15,x4/9,s10,x0/10,s8,x6/12,s2,x13/4,po/d,x5/7,pe/l,x6/10,s9,x12/3,s2,x4/7,s9,x2/13,s8,x7/5,ph/c,s6,x6/0,s14,x2/8,s3,x15/12,s8,x2/0,s11,x9/6,pd/b,x5/11,s8,x1/14,s2,x0/4,s2,x8/9,s1,pc/k,x3/2,pa/j,x9/12,s11,x4/2,s14,pg/p,x12/13,pe/c,x4/10,s11,x7/13,s4,x9/6,pk/m,x0/12,pe/a,x6/15,s4,x0/10,s7,x15/11,po/j,x4/0,s2,x5/11,s2,x8/10,s6,x6/7,s8,x11/13,s9,x4/9,pk/d,x7/8,s3,pa/h,s13,x3/13,pc/m,x12/1,s11,x8/5,pa/k,x6/14,s7,x0/4,s1,x12/8,s9,x6/10,pp/c,x5/9,pm/g,x13/2,ph/e,x10/6,s2,pb/d,s8,x11/2,s2,x3/9,s3,x11/1,pc/o,x13/6,pa/n,x3/12,s11,x2/6,pe/i,x10/3,pc/l,x14/12,s4,x9/4,s11,x5/1,s7,x9/0,s14,x15/3,s13,x8/5,pd/h,x7/6,s1,x10/15,s1,x11/1,s8,x7/9,s3,x12/11,s15,x13/5,s1,x6/9,s12,x8/14,s14,x12/1,s12,x3/4,s9,x2/0,pm/k,x6/8,pp/h,x7/2,pd/j,x1/11,s10,pm/n,x6/3,s6,x10/15,s10,x0/3,s3,x13/15,pb/e,x0/5,s11,x12/9,s2,x2/5,pn/m,x0/12,s3,x5/6,pf/l,x11/13,pp/c,s13,x1/5,pa/j,x0/4,s15,x9/1,pe/h,x13/4,pa/l,x0/9,pf/g,x1/5,s12,x14/0,s1,x6/13,pa/m,x1/5,pb/d,x13/3,pl/k,x14/10,s12,x5/1,pf/b,x4/9,s4,x8/15,s1,po/d,x4/10,pn/j,x1/0,s8,x8/2,pf/k,x14/13,s14,x8/10,s6,pg/j,x2/11,s14,x7/12,s2,x5/13,pi/l,s15,x4/3,s1,x9/2,s10,x10/1,s3,x15/3,s6,x8/13,s2,pd/b,x1/14,s4,pj/k,x10/9,s3,pd/l,x6/0,pk/g,x8/4,s15,x7/6,pe/m,x0/4,s13,x13/6,s11,x3/12,pb/c,x11/10,s15,x2/14,s13,x10/7,pn/i,x3/6,s2,x0/1,pd/o,x4/12,pi/a,x11/14,pm/o,x13/15,s5,x9/1,s7,x10/3,pn/a,x15/0,pb/i,x2/9,pd/j,x11/10,s15,x4/2,pp/h,x9/11,pb/m,x3/2,s14,x7/9,s1,x3/1,po/k,x12/13,s7,x9/5,pd/f,x14/7,s10,x1/5,pg/l,x4/12,s9,x7/2,s6,x13/3,s6,x6/12,s2,x0/9,s10,x14/12,s7,x9/2,pd/o,s7,x10/1,s10,x8/9,pj/g,x12/5,pa/n,x14/3,pf/l,x12/7,pe/g,x13/14,pc/b,x5/7,s1,x14/2,s5,x0/9,pl/h,s9,pb/p,x5/11,s2,x12/0,s1,pc/j,x4/10,pn/i,x9/3,pc/a,x12/10,ph/e,x15/1,s10,x11/12,s10,x10/15,pi/f,x2/11,s2,x6/10,s13,x9/11,s6,x12/15,po/n,s1,x4/7,pe/d,x15/5,s14,x8/1,s15,x2/15,ph/a,x14/7,s2,x3/12,s9,pd/i,x4/8,s14,x3/5,po/j,x2/11,s15,x13/4,pe/g,x9/3,s4,x15/4,s3,x0/6,s8,x3/4,pj/h,x5/8,po/a,x4/6,pi/f,s13,x12/11,s13,x2/8,s13,ph/g,x0/10,s9,x3/2,s7,x5/15,s9,x8/14,pm/c,x5/9,s10,x14/1,pb/f,x15/6,ph/c,s12,x14/7,pk/l,x0/3,ph/o,x7/15,pl/d,x4/3,s6,pi/g,x8/6,s1,x13/3,s12,x5/10,s2,x11/9,s2,x7/13,s4,x5/8,s2,x3/13,s3,x1/14,s11,x0/12,s15,x13/3,s9,x11/6,s10,x10/13,s15,pk/b,x15/12,pf/d,x8/11,ph/o,x9/12,s10,x4/15,s2,x13/14,pg/d,x8/5,pc/e,x15/2,s12,x7/11,pm/l,x6/10,s14,x4/7,ph/f,x5/6,s13,x7/12,s12,x0/1,s15,x10/13,pl/g,x0/3,s7,x9/1,pn/h,x6/5,s10,x4/11,s11,x9/15,s10,x11/14,s2,x13/15,pm/f,x7/2,pj/d,x3/8,s8,pk/g,x7/1,s4,x0/15,s9,x9/3,s14,x12/13,s14,x10/15,s13,x14/5,s14,pc/a,x2/4,s12,x14/5,pn/m,x10/6,s13,x4/14,s5,po/b,x10/6,s10,x1/7,s9,x13/11,s1,x9/8,s15,x7/3,s9,x12/10,s5,x13/15,s4,x5/14,s9,x8/4,s8,x7/13,s6,x0/12,s11,x3/15,pd/l,x7/14,ph/j,x9/10,s10,x4/3,pm/d,x6/0,s4,x14/1,pg/h,x10/12,pm/k,x14/8,ph/j,x2/7,s2,x9/5,s2,pl/i,x3/1,pb/c,s15,x6/11,s9,x7/9,pn/a,x10/12,pe/f,x11/14,s14,x8/0,s14,x7/6,pj/p,x13/2,pf/o,x12/1,s6,x6/4,pn/k,x12/1,pd/a,s11,x3/2,s11,x15/14,s6,x3/11,s8,x4/8,s2,x10/5,s4,pp/n,s2,x8/13,s15,x11/9,s1,x7/13,s15,pj/b,x1/8,pf/o,x13/4,pm/g,x14/8,pl/i,x11/0,pj/f,x14/2,pl/k,x4/13,pa/m,x5/11,pk/c,x4/3,pd/e,x13/6,s14,x1/10,pn/g,x0/8,pe/l,s1,x13/9,s7,x5/14,pd/o,x1/0,pn/g,x10/7,ph/j,x2/1,pk/c,x0/8,s9,x3/2,s5,x8/4,pg/l,x9/12,s14,x13/3,s5,x4/6,s1,pf/d,x0/13,pn/o,x6/12,pf/h,x11/9,s5,x5/15,pk/j,x12/8,s3,x10/13,s3,x6/9,s10,x15/2,s10,x7/4,pi/e,x5/6,s6,x12/1,pg/f,x11/0,s10,x6/4,pa/e,x2/9,pl/h,s15,x1/10,s13,pc/p,x11/3,s9,x13/2,s6,x5/6,pg/n,s14,x12/14,s2,x11/4,s15,x6/13,pc/d,x12/2,s6,x6/11,pi/j,s10,x3/1,pp/d,x0/13,s4,x1/11,ph/e,x4/6,s4,x7/5,s1,x8/6,pi/o,s4,x9/11,s15,x1/6,pc/g,x15/8,s9,x6/7,pl/o,x5/9,s10,x2/8,pg/b,x6/9,s10,x3/15,pl/h,x6/9,po/c,s15,x15/5,s13,x6/12,pb/a,x1/15,pm/d,x7/0,pp/e,x1/15,po/f,x3/14,s12,x2/7,s7,x14/12,s10,pb/h,x13/7,s2,x5/2,pi/j,x11/6,pb/m,x15/8,s8,x6/1,s8,x13/7,ph/f,x9/15,s1,x8/6,s2,x11/3,pl/a,x5/0,s8,x1/12,s12,x8/4,s4,x1/7,s1,x13/15,pg/o,x7/1,pj/c,x14/12,pi/p,x10/6,s13,x2/1,pe/f,x9/14,s6,x6/1,s12,x11/10,s15,ph/c,x6/15,pn/o,x3/13,pi/p,x2/15,s12,x0/8,ph/o,x10/9,pn/i,x6/12,s12,x10/7,s8,x9/11,pg/d,x14/6,pe/n,x13/7,s6,x10/3,s13,x7/5,pk/g,x3/1,s11,x6/14,s14,pl/d,s2,pk/m,x8/15,pl/j,x3/0,s3,x1/4,s7,x8/0,ph/e,x6/7,pd/p,s15,x1/11,s3,x10/8,s11,x14/4,s8,x8/1,s13,x15/11,s7,x0/6,po/l,x5/11,s12,x12/0,pf/k,x9/13,s13,x12/10,pa/b,x2/14,s7,x12/10,pc/e,s15,x3/5,pl/i,x11/4,s5,x3/13,s5,x6/12,s2,x13/7,s4,x3/5,pk/n,x12/14,pa/p,x11/0,s11,x12/3,s6,x11/0,s11,x12/6,s13,x5/13,pd/l,x3/15,s1,x14/7,pg/f,x5/3,pj/m,x10/7,pb/n,x3/0,s4,x5/8,pd/m,x14/15,pa/c,x2/8,s13,pb/e,x9/13,s13,x11/15,s5,x5/0,s8,x2/6,pk/d,x10/9,pa/o,x3/2,s9,x0/15,pj/d,x5/8,pc/n,x6/0,s1,x5/1,s13,x7/9,s8,x5/1,pj/p,x9/0,s2,pk/h,x15/13,s15,x7/2,pc/a,x3/0,s12,x10/14,pd/p,x2/0,s6,x3/9,pk/c,x13/1,pb/i,s5,x8/10,pl/o,x15/14,s3,x6/11,pf/c,x4/7,s10,x14/5,s1,x0/4,s1,x12/9,s5,x15/13,s4,x6/12,s13,pp/i,x0/11,s11,x10/6,pg/b,x8/7,s2,x3/9,s10,x11/4,s15,x15/8,s7,x1/0,s10,x9/3,s2,x12/8,s5,x4/10,pc/d,x7/6,s13,pi/e,x3/14,s9,x1/4,s15,x15/5,pc/l,x3/13,s13,x11/6,s14,x4/7,pe/h,x11/6,s5,x2/13,pc/g,x3/4,pp/b,x15/13,s4,x11/5,s14,x2/6,ph/a,x11/1,s7,x14/7,s10,x0/9,s14,x3/8,s15,x6/9,s10,x12/11,s4,x7/5,pc/n,x8/2,s9,x3/4,s4,x2/7,s11,x1/10,s3,x7/11,s3,x1/14,s2,x3/4,ph/d,x5/9,s6,x7/14,s14,x11/9,pg/a,x3/2,po/e,x6/7,pb/c,x15/2,s1,x0/7,s8,x5/8,s1,x2/13,pe/h,x15/3,pd/i,x1/14,pe/k,x2/6,pa/h,x13/0,s4,x9/5,pg/f,x14/13,pi/l,s4,x7/12,s14,x2/15,s15,x3/12,s9,x4/15,s2,pm/k,x0/14,s10,x1/9,s9,pa/h,x14/5,s6,x11/0,pk/j,x6/15,pm/e,x14/0,pp/a,x7/12,s9,x3/1,s13,pe/c,x4/8,po/f,x10/14,pa/h,x4/11,pi/e,s5,x7/5,pn/h,s10,x15/8,s8,x13/0,s15,x11/4,s13,x13/3,s8,x11/10,pb/d,s5,x1/7,s1,x8/9,s9,x10/2,s3,x11/13,s11,pj/n,x4/10,pf/l,x15/7,pp/a,x6/4,ph/e,s2,x9/7,s8,x11/3,pj/d,x2/5,s3,x15/1,s6,x5/8,pe/l,s12,x3/6,s10,x8/12,pf/j,x13/3,pb/o,x1/12,s5,x2/4,s2,x1/6,s15,x10/11,pg/j,s2,x12/9,pc/d,x8/11,s15,po/h,x0/7,s7,x8/6,s10,x13/15,s12,x12/9,s11,x6/1,pf/j,x0/11,pn/p,x9/1,s15,x3/8,s8,pm/h,s9,x4/10,s12,x13/0,pg/k,s5,x15/9,pf/c,s7,x10/4,s7,x15/9,s6,x6/7,s10,x8/3,s10,x11/1,ph/p,x10/2,pi/m,x5/3,s9,x6/10,s9,x9/11,s8,x13/10,pn/a,x15/0,pc/k,x5/3,s5,x13/2,s10,x6/1,s3,pp/a,x9/0,s12,x7/14,s5,x11/1,s9,x4/5,s9,x8/7,s2,x13/15,pb/h,x12/2,pd/e,s2,pc/j,x9/3,s13,x15/12,pe/b,x1/10,s13,x5/7,s3,x10/3,ph/o,x7/2,s3,x5/8,pp/b,x10/12,s3,x1/7,s7,x2/14,pl/j,x15/7,s4,x12/9,pn/h,x14/10,pk/i,s13,x1/3,s6,x13/12,pb/n,x9/2,s10,x0/12,s9,x6/4,pe/a,s10,x9/13,s8,x0/11,s7,x10/3,s12,x12/9,s11,x1/10,s2,pf/n,x15/0,pe/i,x5/11,s14,x8/14,s15,x11/1,pf/b,x14/12,pi/d,x8/6,s12,x12/4,pj/n,x13/6,s11,x0/12,s4,x1/13,pi/d,x11/7,s13,x5/15,s12,x4/2,s11,x10/13,pc/a,s8,x3/4,s7,pe/k,x0/5,pj/f,x1/8,s5,x10/13,s13,pd/p,x3/8,pf/a,s12,x1/14,s8,x11/8,ph/i,s8,x6/13,s7,x15/4,s9,x8/0,s5,x10/4,pl/j,s14,x12/2,s9,x7/15,s1,x10/11,s14,x1/7,s3,x15/12,s2,x5/4,s4,pn/h,x12/6,s1,x10/2,s2,x6/4,pc/b,x7/0,s14,x3/5,s9,x15/13,pk/f,x2/11,s3,x7/6,pe/h,x0/15,pf/n,s12,x12/9,s4,x11/8,s14,x14/9,pa/i,x8/15,pk/j,x11/9,ph/p,x12/1,s5,pb/k,x2/3,s10,x1/0,s13,x7/12,pa/m,x8/1,s8,x2/14,s10,x13/15,pn/k,x14/12,s15,x10/0,s1,x1/14,s15,x3/9,pc/h,x11/5,pm/k,x4/0,s5,x6/5,s3,x2/14,pi/c,x1/3,s9,x5/11,pf/b,x1/6,pk/h,x9/4,pj/e,x1/2,pf/d,x5/11,s9,x14/2,s13,x4/15,s7,x5/0,pc/l,x6/8,s13,x14/15,s11,x2/6,po/k,x8/9,pj/f,x7/5,s15,x8/12,s7,x14/5,s1,pl/m,x0/11,pp/o,x1/7,pd/j,x9/10,s10,x12/14,s14,x1/7,pi/k,x9/11,pa/o,x13/0,s4,x3/9,s9,x8/13,s9,pj/f,x12/2,s12,x14/13,pk/i,x10/5,s3,x15/2,pd/g,s6,x14/1,pe/p,x13/9,s11,x10/4,s13,pd/o,x9/11,s9,x5/10,pp/j,x0/11,s3,x3/9,s5,x13/7,pk/f,s8,x10/12,s10,x9/0,s4,x15/12,s1,x0/13,pn/d,x6/1,s2,x7/14,s1,x9/2,s4,x4/5,s14,x6/10,s15,pk/j,x4/15,pp/f,x12/14,s10,x8/15,s3,x4/7,s4,x9/12,pi/k,s3,x2/15,s12,x3/5,pl/b,x1/10,s2,pp/a,x9/3,pn/e,x14/10,pi/h,x3/12,pg/o,x4/7,pa/h,x13/15,s1,x6/11,pg/i,x0/1,pn/l,x12/6,pp/b,x11/9,s11,x13/4,pl/a,x11/2,pk/i,x1/3,pb/n,x7/14,s12,x12/10,s6,x2/6,po/p,x7/1,s9,x8/5,pk/i,x10/12,s15,x15/3,s5,x1/2,pn/d,x0/3,s7,x6/5,s15,x3/12,pl/i,x7/5,s15,x1/14,pf/g,x6/9,s13,x2/11,pm/e,s8,pb/c,s15,x9/3,pi/j,x15/0,s2,pb/d,x7/9,po/h,s6,x1/8,s5,x10/6,s4,x14/0,pa/d,x8/13,s12,x11/4,s9,x3/0,s6,pg/i,x8/10,ph/l,x5/14,pp/e,x6/7,s4,x4/5,po/a,x13/3,s1,x15/7,pk/j,s15,x13/4,s9,x11/14,s15,x10/9,s7,pd/p,x0/3,pa/e,x11/8,s10,x4/3,pc/k,x8/0,ph/n,x10/9,s10,x7/14,pk/i,x12/2,s13,x9/7,s12,x14/5,pj/g,x1/6,s6,x8/13,s12,x12/9,s9,x7/4,s9,x5/8,s7,pc/b,x6/3,s10,x11/2,s9,x0/9,s10,pj/n,x10/15,pa/k,s14,x2/7,s7,x14/10,s13,x4/15,pc/h,x14/11,pd/a,x10/4,s6,x5/6,s15,x9/1,s15,x11/5,s3,x2/15,s11,x6/12,s5,x15/9,pp/h,x5/0,s6,x15/7,pg/b,x6/5,pl/a,x1/7,s14,ph/n,x15/9,pf/o,x13/2,s3,x3/4,pk/b,x14/1,pp/e,x6/15,s13,x8/11,s2,x4/12,s6,x13/0,s1,x9/11,s3,x8/12,pi/l,x0/15,s14,pe/g,x1/2,pn/l,x5/11,pj/m,x15/1,s3,x3/6,pf/l,x13/2,pk/a,s15,x15/14,pn/c,x11/7,s15,x15/8,s8,x11/3,s10,x7/8,ph/b,x12/1,s13,x14/4,pe/o,x11/5,s2,x8/0,s4,pc/f,x14/10,s6,x15/11,s14,x14/6,s2,pp/m,x3/12,ph/k,x1/9,s4,x4/0,pc/o,x9/10,pd/n,x7/11,pk/a,x2/13,pc/h,x11/1,pj/m,x0/4,s4,x10/6,s9,po/l,x4/7,pn/b,s10,x6/5,s9,x3/14,s12,x10/8,s7,pl/j,x4/7,s12,x13/5,s15,x0/11,s1,pb/g,x2/6,s9,x15/0,s4,x10/4,s9,x11/13,ph/e,x2/4,s13,x6/12,pg/k,x10/13,s4,x0/12,s11,x5/8,pn/i,x11/15,pb/d,x3/10,s7,x11/4,s4,x2/9,s13,x3/13,pj/i,x2/10,s8,x12/15,s15,x5/11,pm/h,s15,x2/14,s15,x9/4,s12,x5/2,s10,x14/11,s15,x1/0,pf/a,x14/10,s10,x4/1,s1,x5/8,s5,x1/3,s2,x0/10,s8,x13/14,s3,x3/0,s15,x6/10)";
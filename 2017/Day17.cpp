@@ -1,28 +1,117 @@
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <cstdint>
+
+/*
+    Circular buffer as a blocked rope: the buffer is a list of blocks of at most 2*block_size values, split in half when they overflow.
+    Consecutive inserts land step+1 positions apart, so a cursor(block and its start position) only ever moves a block or so forward,
+    and is only reset to the front when the position wraps around. Every insert is then a short memmove inside one cache-hot block.
+    owner maps a value to the id of the block holding it, which is enough to find its position when a query comes in.
+*/
+class Spinlock {
+    static constexpr std::size_t block_size = 1024;
+
+    struct Block {
+        std::uint32_t id;
+        std::vector<std::uint32_t> values;
+    };
+
+    std::size_t step;
+    std::vector<Block> blocks;
+    std::vector<std::uint32_t> owner;
+    std::size_t total = 1;
+    std::size_t loc = 0;
+    std::size_t cursor = 0, cursor_start = 0;
+
+    void insert_at(std::size_t pos, std::uint32_t value) {
+        if(pos < cursor_start) {
+            cursor = cursor_start = 0;
+        }
+        while(pos > cursor_start + blocks[cursor].values.size() and cursor+1 < blocks.size()) {
+            cursor_start += blocks[cursor++].values.size();
+        }
+        auto& values = blocks[cursor].values;
+        values.insert(values.begin() + (pos - cursor_start),value);
+        owner.push_back(blocks[cursor].id);
+        ++total;
+
+        if(values.size() > 2*block_size) {
+            Block next{std::uint32_t(blocks.size()),{values.begin()+block_size,values.end()}};
+            values.resize(block_size);
+            for(auto v : next.values) owner[v] = next.id;
+            blocks.insert(blocks.begin()+cursor+1,std::move(next));
+        }
+    }
+
+public:
+    explicit Spinlock(std::size_t step, std::size_t capacity = 0): step(step), blocks{{0,{0}}}, owner{0} {
+        owner.reserve(capacity+1);
+    }
+
+    std::size_t count() const {
+        return total;
+    }
+
+    //Inserts the next n values
+    void run(std::size_t n) {
+        for(std::size_t i = 0; i < n; ++i) {
+            auto value = count();
+            loc = (loc + step) % value + 1;
+            insert_at(loc,value);
+        }
+    }
+
+    std::size_t rank(std::uint32_t value) const {
+        std::size_t start = 0;
+        for(auto& b : blocks) {
+            if(b.id == owner[value]) {
+                return start + (std::find(b.values.begin(),b.values.end(),value) - b.values.begin());
+            }
+            start += b.values.size();
+        }
+        return total;
+    }
+
+    std::uint32_t at(std::size_t pos) const {
+        for(auto& b : blocks) {
+            if(pos < b.values.size()) return b.values[pos];
+            pos -= b.values.size();
+        }
+        return 0;
+    }
+
+    std::uint32_t value_after(std::uint32_t value) const {
+        return at((rank(value) + 1) % count());
+    }
+};
+
+/*
+    0 never moves from position 0, so whatever follows it is the last value inserted at position 1. Only the position has to be tracked.
+    While the position plus a step stays below the buffer size nothing wraps, and a whole run of those inserts is skipped at once.
+*/
+std::uint64_t after_zero(std::uint64_t step, std::uint64_t inserts) {
+    std::uint64_t loc = 0, ret = 0;
+    for(std::uint64_t i = 1; i <= inserts;) {
+        if(loc + step < i) {
+            auto skip = std::min((i - loc - step + step - 1) / step, inserts - i + 1);
+            loc += skip*(step+1);
+            i += skip;
+            continue;
+        }
+        loc = (loc + step) % i;
+        if(loc == 0) ret = i;
+        ++loc;
+        ++i;
+    }
+    return ret;
+}
 
 int main() {
     constexpr int input = 394;
 
-    std::vector<int> buffer;
-    buffer.reserve(2018);
-    buffer.push_back(0);
-    int loc = 0;
-    for(int i = 1; i <= 2017; ++i) {
-        loc += input;
-        loc %= i;
-        buffer.insert(buffer.begin()+loc+1,i);
-        loc++;
-    }
-    std::cout << "Part 1: " << buffer[(loc+1) % 2018] << '\n';
-    
-    loc = 0;
-    int part2 = 0;
-    for(int i = 1; i <= 50'000'000; ++i) {
-        loc += input;
-        loc %= i;
-        if(loc == 0) part2 = i;
-        loc++;
-    }
-    std::cout << "Part 2: " << part2 << '\n';
+    Spinlock buffer(input,2017);
+    buffer.run(2017);
+    std::cout << "Part 1: " << buffer.value_after(2017) << '\n';
+    std::cout << "Part 2: " << after_zero(input,50'000'000) << '\n';
 }
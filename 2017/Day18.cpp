@@ -1,10 +1,19 @@
 #include <iostream>
 #include <string_view>
+#include <string>
 #include <array>
 #include <deque>
 #include <charconv>
 #include <numeric>
 #include <algorithm>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <bit>
+#include <utility>
+#include <cstdint>
 
 template<typename F>
 void split(std::string_view in, char delim, F&& f) {
@@ -80,24 +89,89 @@ auto parse(std::string_view input) {
     return instructions;
 }
 
+/*
+    Single producer/single consumer queue over a chain of fixed size blocks, so a send never has to wait for the receiver.
+    The producer only writes tail and links a new block before publishing the first value in it, the consumer only writes head and frees the blocks it has read past.
+*/
+class Mailbox {
+    struct Block {
+        std::vector<int64_t> values;
+        std::atomic<Block*> next = nullptr;
+
+        explicit Block(std::size_t size): values(size) {}
+    };
+
+    std::size_t mask;
+    alignas(64) std::atomic<std::size_t> head = 0;
+    Block* first;
+    alignas(64) std::atomic<std::size_t> tail = 0;
+    Block* last;
+
+public:
+    explicit Mailbox(std::size_t block_size = 1 << 10): mask(std::bit_ceil(block_size)-1), first(new Block(mask+1)), last(first) {}
+
+    Mailbox(const Mailbox&) = delete;
+    Mailbox& operator=(const Mailbox&) = delete;
+
+    ~Mailbox() {
+        while(first) delete std::exchange(first,first->next.load(std::memory_order_relaxed));
+    }
+
+    void push(int64_t v) {
+        auto t = tail.load(std::memory_order_relaxed);
+        if(t != 0 and (t & mask) == 0) {
+            auto block = new Block(mask+1);
+            last->next.store(block,std::memory_order_release);
+            last = block;
+        }
+        last->values[t & mask] = v;
+        tail.store(t+1,std::memory_order_release);
+    }
+
+    bool pop(int64_t& v) {
+        auto h = head.load(std::memory_order_relaxed);
+        if(h == tail.load(std::memory_order_acquire)) return false;
+        if(h != 0 and (h & mask) == 0) delete std::exchange(first,first->next.load(std::memory_order_acquire));
+        v = first->values[h & mask];
+        head.store(h+1,std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+};
+
+enum class Status {
+    terminated,
+    blocked_rcv
+};
+
 struct Prog {
     std::array<int64_t,26> regs = {0};
-    int pc = 0;
-    std::deque<int64_t> input = {};
+    int64_t pc = 0;
     int total_sent = 0;
+    int64_t last_sent = 0;
 
     int64_t get(Ins s) const {
         if(s.arg_constant) return s.arg;
         return regs[s.arg];
     }
-    bool run(const std::vector<Ins>& instructions, Prog& other) {
-        while(pc >= 0 && pc < instructions.size()) {
+
+    //Runs until the program terminates or blocks, leaving pc on the blocking instruction. on_send fires after every value sent
+    template<typename Send>
+    Status run(const std::vector<Ins>& instructions, Mailbox& in, Mailbox& out, Send&& on_send) {
+        while(pc >= 0 && pc < int64_t(instructions.size())) {
             auto current = instructions[pc];
             switch(current.type) {
-                case Type::snd:
+                case Type::snd: {
+                    auto v = current.reg_constant ? current.reg : regs[current.reg];
+                    out.push(v);
                     total_sent++;
-                    other.input.push_back(current.reg_constant ? current.reg : regs[current.reg]);
+                    last_sent = v;
+                    on_send();
                     break;
+                }
                 case Type::set:
                     regs[current.reg] = get(current);
                     break;
@@ -111,9 +185,7 @@ struct Prog {
                     regs[current.reg] %= get(current);
                     break;
                 case Type::rcv:
-                    if(input.empty()) return false;
-                    regs[current.reg] = input.front();
-                    input.pop_front();
+                    if(not in.pop(regs[current.reg])) return Status::blocked_rcv;
                     break;
                 case Type::jgz:
                     if((current.reg_constant ? current.reg : regs[current.reg]) > 0) {
@@ -123,25 +195,145 @@ struct Prog {
             }
             ++pc;
         }
-        return true;
+        return Status::terminated;
+    }
+};
+
+/*
+    Runs N copies of the program in a ring, program i sending to i+1 and setting p to its own id, so every mailbox has exactly one producer and one consumer.
+    A program runs until it waits on an empty mailbox, then parks. Sending wakes the receiver by moving it back onto the ready queue if it was parked.
+    A blocked program marks itself parked before re-checking its mailbox, and wakers check the state after touching the mailbox, so no wakeup is lost.
+    active counts ready and running programs. Reaching 0 means every live program is parked, which is the deadlock that ends the network.
+    Mailboxes grow as needed, so only waiting to receive can block a program and a deadlock is always a real one.
+*/
+class Network {
+    enum State : int {READY,RUNNING,PARKED,DONE};
+
+    const std::vector<Ins>& code;
+    std::size_t n;
+    std::vector<Prog> progs;
+    std::deque<Mailbox> inbox;
+    std::vector<std::atomic<int>> state;
+    std::atomic<std::size_t> active;
+
+    std::deque<std::size_t> ready;
+    std::mutex ready_lock;
+    std::condition_variable ready_cv;
+    bool threaded = false;
+    bool stopped = false;
+
+    std::size_t target(std::size_t i) const {
+        return (i+1) % n;
+    }
+
+    void enqueue(std::size_t i) {
+        if(threaded) {
+            std::lock_guard lock(ready_lock);
+            ready.push_back(i);
+            ready_cv.notify_one();
+        } else {
+            ready.push_back(i);
+        }
+    }
+
+    void wake(std::size_t i) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int expected = PARKED;
+        if(state[i].compare_exchange_strong(expected,READY)) {
+            ++active;
+            enqueue(i);
+        }
+    }
+
+    void execute(std::size_t i) {
+        state[i] = RUNNING;
+        while(true) {
+            auto status = progs[i].run(code,inbox[i],inbox[target(i)],[&]{wake(target(i));});
+            if(status == Status::terminated) {
+                state[i] = DONE;
+                break;
+            }
+            state[i] = PARKED;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int expected = PARKED;
+            if(inbox[i].empty() or not state[i].compare_exchange_strong(expected,RUNNING)) break;
+        }
+        if(--active == 0) {
+            std::lock_guard lock(ready_lock);
+            stopped = true;
+            ready_cv.notify_all();
+        }
+    }
+
+public:
+    Network(const std::vector<Ins>& code, std::size_t n, std::size_t mailbox_block = 1 << 10): code(code), n(n), progs(n), state(n), active(n) {
+        for(std::size_t i = 0; i < n; ++i) {
+            progs[i].regs['p'-'a'] = i;
+            inbox.emplace_back(mailbox_block);
+            state[i] = READY;
+            ready.push_back(i);
+        }
+    }
+
+    void run_single() {
+        while(not ready.empty()) {
+            auto i = ready.front();
+            ready.pop_front();
+            execute(i);
+        }
+    }
+
+    void run_threads(unsigned num_threads = std::thread::hardware_concurrency()) {
+        threaded = true;
+        auto worker = [this] {
+            while(true) {
+                std::size_t i;
+                {
+                    std::unique_lock lock(ready_lock);
+                    ready_cv.wait(lock,[this]{return stopped or not ready.empty();});
+                    if(ready.empty()) return;
+                    i = ready.front();
+                    ready.pop_front();
+                }
+                execute(i);
+            }
+        };
+        std::vector<std::thread> threads;
+        for(unsigned t = 0; t < std::max(1u,num_threads); ++t) threads.emplace_back(worker);
+        for(auto& t : threads) t.join();
+    }
+
+    //Some program is still waiting once the network has stopped
+    bool deadlocked() const {
+        return std::any_of(state.begin(),state.end(),[](auto& s) {return s == PARKED;});
+    }
+
+    const Prog& program(std::size_t i) const {
+        return progs[i];
     }
 };
 
-void solution(std::string_view input) {
+//Besides the two part duet, optionally runs a ring of that many programs on that many threads
+void solution(std::string_view input, std::size_t ring_size, unsigned threads) {
     auto instructions = parse(input);
-    Prog p0,p1;
-    p0.regs['p'-'a'] = 0;
-    p1.regs['p'-'a'] = 1;
-    bool terminated0 = false;
-    bool terminated1 = false;
-    p0.run(instructions,p1);
-    std::cout << "Part 1: " << p1.input.back() << '\n';
-    while(p0.input.size() || p1.input.size()) {
-        terminated1 = p1.run(instructions,p0);
-        terminated0 = p0.run(instructions,p1);
-        if(terminated0 && terminated1) break;
-    }
-    std::cout << "Part 2: " << p1.total_sent << '\n';
+
+    //Part 1 semantics: the first rcv that would have to wait recovers the last sound played
+    Prog p0;
+    Mailbox none, sounds;
+    p0.run(instructions,none,sounds,[]{});
+    std::cout << "Part 1: " << p0.last_sent << '\n';
+
+    Network duet(instructions,2);
+    duet.run_single();
+    std::cout << "Part 2: " << duet.program(1).total_sent << '\n';
+
+    if(ring_size == 0) return;
+    Network ring(instructions,ring_size);
+    ring.run_threads(threads);
+    std::uint64_t sent = 0;
+    for(std::size_t i = 0; i < ring_size; ++i) sent += ring.program(i).total_sent;
+    std::cout << "Ring of " << ring_size << " on " << threads << " threads: " << sent << " values sent, "
+              << (ring.deadlocked() ? "stopped with programs waiting to receive" : "all programs terminated") << '\n';
 }
 
 std::string_view input = R"(set i 31
@@ -186,6 +378,9 @@ snd a
 jgz f -16
 jgz a -19)";
 
-int main() {
-    solution(input);
+//Optional arguments: the size of a ring of programs to run as well(at least 2) and the number of threads for it
+int main(int argc, char** argv) {
+    std::size_t ring_size = argc > 1 ? std::max<std::size_t>(2,std::stoul(argv[1])) : 0;
+    unsigned threads = std::max(1u,argc > 2 ? unsigned(std::stoul(argv[2])) : std::thread::hardware_concurrency());
+    solution(input,ring_size,threads);
 }
@@ -7,6 +7,11 @@
 #include <charconv>
 #include <numeric>
 #include <algorithm>
+#include <vector>
+#include <limits>
+#include <thread>
+#include <cstdint>
+#include <bit>
 
 template<typename F>
 void split(std::string_view in, char delim, F&& f) {
@@ -31,17 +36,17 @@ auto split_known(std::string_view in, char delim, F&& apply) {
     return ret;
 }
 
-int to_int(std::string_view s) {
-    int ret;
+std::int64_t to_int(std::string_view s) {
+    std::int64_t ret = 0;
     std::from_chars(s.begin(),s.end(),ret);
     return ret;
 }
 
 struct Particle {
-    std::array<int,3> pos;
-    std::array<int,3> vel;
-    std::array<int,3> acc;
-    int time_of_death = std::numeric_limits<int>::max();
+    std::array<std::int64_t,3> pos;
+    std::array<std::int64_t,3> vel;
+    std::array<std::int64_t,3> acc;
+    std::int64_t time_of_death = std::numeric_limits<std::int64_t>::max();
 };
 
 auto parse(std::string_view input) {
@@ -62,7 +67,7 @@ auto part1(const decltype(parse(""))& input) {
 }
 
 struct Collision {
-    std::array<int,2> collisions = {0,0};
+    std::array<std::int64_t,2> collisions = {0,0};
     int num_collisions = 0; //-1 = infinite
 
     Collision merge(Collision o) {
@@ -77,33 +82,41 @@ struct Collision {
     }
 };
 
-int collide(Particle a, Particle b) {
+std::int64_t isqrt(std::int64_t n) {
+    auto r = std::int64_t(std::sqrt(double(n)));
+    while(r*r > n) --r;
+    while((r+1)*(r+1) <= n) ++r;
+    return r;
+}
+
+//Earliest tick >= 0 at which a and b are in the same spot, -1 if never
+std::int64_t collide(const Particle& a, const Particle& b) {
     auto coord = [&](int num) -> Collision {
-        int A = a.acc[num] - b.acc[num];
-        int B = 2*(a.vel[num] - b.vel[num]) + A;
-        int C = 2*(a.pos[num] - b.pos[num]);
+        std::int64_t A = a.acc[num] - b.acc[num];
+        std::int64_t B = 2*(a.vel[num] - b.vel[num]) + A;
+        std::int64_t C = 2*(a.pos[num] - b.pos[num]);
 
         if(A == 0) {
             if(B == 0 and C == 0)
                 return {{0,0},-1}; //same particle wrt this coordinate
             else if(B == 0)
                 return {}; //colinear but parallel
-            else if(C % B == 0)
-                return {{C/B,0},1};
+            else if(C % B == 0 and -C/B >= 0)
+                return {{-C/B,0},1};
             return {}; //no integer solution
         }
 
-        int D = B*B - 4*A*C;
+        std::int64_t D = B*B - 4*A*C;
         if(D < 0) return {};
-        int Dsqrt = std::sqrt(D);
+        std::int64_t Dsqrt = isqrt(D);
         if(Dsqrt*Dsqrt == D) {
             Collision ret;
-            if((-B - Dsqrt)*A >= 0 and (-B - Dsqrt) % (2*A) == 0) {
-                ret.collisions[ret.num_collisions++] = (-B - Dsqrt) / (2*A);
-            }
-            if((-B + Dsqrt)*A >= 0 and (-B + Dsqrt) % (2*A) == 0) {
-                ret.collisions[ret.num_collisions++] = (-B + Dsqrt) / (2*A);
+            for(auto num : {-B - Dsqrt, -B + Dsqrt}) {
+                if(num*A >= 0 and num % (2*A) == 0) {
+                    ret.collisions[ret.num_collisions++] = num / (2*A);
+                }
             }
+            if(ret.num_collisions == 2 and ret.collisions[0] > ret.collisions[1]) std::swap(ret.collisions[0],ret.collisions[1]);
             return ret;
         }
         return {};
@@ -129,33 +142,227 @@ int collide(Particle a, Particle b) {
 }
 
 struct CollisionEvent {
-    int time;
+    std::int64_t time;
     size_t p1, p2;
 };
 
-auto part2(decltype(parse("")) input) {
-    std::vector<CollisionEvent> collisions;
-    for(std::size_t i = 0; i < input.size()-1;++i) {
-        for(std::size_t j = i+1; j < input.size(); ++j) {
-            if(int time = collide(input[i],input[j]); time != -1) {
-                collisions.push_back({time,i,j});
+template<typename F>
+void parallel_for(std::size_t n, F&& f) {
+    std::size_t num_threads = std::clamp<std::size_t>(n / (1 << 14),1,std::max(1u,std::thread::hardware_concurrency()));
+    std::size_t chunk = (n + num_threads - 1) / num_threads;
+    std::vector<std::thread> threads;
+    for(std::size_t t = 1; t < num_threads; ++t) {
+        threads.emplace_back([&,t] {f(t,t*chunk,std::min(n,(t+1)*chunk));});
+    }
+    f(0,0,std::min(n,chunk));
+    for(auto& t : threads) t.join();
+}
+
+std::uint64_t position_hash(const Particle& p) {
+    std::uint64_t h = 0;
+    for(int k = 0; k < 3; ++k) {
+        h = (h ^ std::uint64_t(p.pos[k])) * 0x9E3779B97F4A7C15ull;
+    }
+    return h ^ (h >> 31);
+}
+
+//Inserts every particle into a linear probing table keyed by its position hash and returns the indices of every particle sharing its exact position with another one
+std::vector<std::size_t> same_position(const std::vector<Particle>& ps) {
+    constexpr auto empty = std::numeric_limits<std::uint32_t>::max();
+    std::vector<std::uint64_t> hashes(ps.size());
+    parallel_for(ps.size(),[&](std::size_t, std::size_t begin, std::size_t end) {
+        for(auto i = begin; i < end; ++i) hashes[i] = position_hash(ps[i]);
+    });
+
+    std::size_t bits = std::bit_width(2*ps.size());
+    std::vector<std::uint32_t> table(std::size_t(1) << bits,empty);
+    std::vector<std::uint8_t> hit(ps.size());
+    bool any = false;
+    for(std::uint32_t i = 0; i < ps.size(); ++i) {
+        for(auto slot = hashes[i] >> (64 - bits);; slot = (slot + 1) & (table.size()-1)) {
+            auto j = table[slot];
+            if(j == empty) {
+                table[slot] = i;
+                break;
+            }
+            if(hashes[j] == hashes[i] and ps[j].pos == ps[i].pos) {
+                hit[i] = hit[j] = true;
+                any = true;
+                break;
+            }
+        }
+    }
+
+    std::vector<std::size_t> ret;
+    if(any) {
+        for(std::size_t i = 0; i < ps.size(); ++i) {
+            if(hit[i]) ret.push_back(i);
+        }
+    }
+    return ret;
+}
+
+//Along one axis, a pair that is apart and whose leader is never slower and never accelerates less stays apart forever
+bool separated(const Particle& a, const Particle& b, int k) {
+    auto dp = b.pos[k] - a.pos[k], dv = b.vel[k] - a.vel[k], da = b.acc[k] - a.acc[k];
+    if(dp < 0) {
+        dp = -dp;
+        dv = -dv;
+        da = -da;
+    }
+    if(dp > 0) return dv >= 0 and da >= 0;
+    return ((dv >= 0 and da >= 0) or (dv <= 0 and da <= 0)) and not (dv == 0 and da == 0);
+}
+
+/*
+    Merge sorts order by seq and calls emit(first,last,j) whenever element j jumps the remaining left half [first,last),
+    which is exactly the run of elements before j in the original order that are larger. Counting is O(n log n), listing O(n log n + pairs).
+*/
+template<typename F>
+void for_each_inversion(const std::vector<std::int64_t>& seq, std::vector<std::size_t> order, F&& emit) {
+    std::vector<std::size_t> buffer(order.size());
+    for(std::size_t width = 1; width < order.size(); width *= 2) {
+        for(std::size_t lo = 0; lo + width < order.size(); lo += 2*width) {
+            auto mid = lo + width, hi = std::min(order.size(),lo + 2*width);
+            auto l = lo, r = mid, out = lo;
+            while(l < mid or r < hi) {
+                if(r == hi or (l < mid and seq[order[l]] <= seq[order[r]])) {
+                    buffer[out++] = order[l++];
+                } else {
+                    emit(order.begin()+l,order.begin()+mid,order[r]);
+                    buffer[out++] = order[r++];
+                }
             }
+            std::copy(buffer.begin()+lo,buffer.begin()+hi,order.begin()+lo);
+        }
+    }
+}
+
+/*
+    Pairs that are not separated on any axis, the only ones that can still collide.
+    Sorted on an axis by position, a pair is only unseparated there if velocity or acceleration is out of order, or if both move identically on that axis.
+    Those are enumerated for the axis with the fewest of them(counted as inversions first) and filtered on the other two axes in parallel.
+    Returns nullopt instead when even the best axis has more than budget candidates, since the cloud is clearly still converging.
+*/
+std::optional<std::vector<std::pair<std::size_t,std::size_t>>> converging_pairs(const std::vector<Particle>& ps, std::size_t budget) {
+    std::array<std::vector<std::size_t>,3> order;
+    std::array<std::size_t,3> count{};
+    std::array<std::vector<std::int64_t>,3> vel, acc;
+    auto same_motion = [&](std::size_t i, std::size_t j, int k) {
+        return ps[i].pos[k] == ps[j].pos[k] and ps[i].vel[k] == ps[j].vel[k] and ps[i].acc[k] == ps[j].acc[k];
+    };
+    for(int k = 0; k < 3; ++k) {
+        auto& o = order[k];
+        o.resize(ps.size());
+        std::iota(o.begin(),o.end(),0);
+        std::sort(o.begin(),o.end(),[&](auto i, auto j) {
+            return std::tie(ps[i].pos[k],ps[i].vel[k],ps[i].acc[k]) < std::tie(ps[j].pos[k],ps[j].vel[k],ps[j].acc[k]);
+        });
+        for(auto& p : ps) {
+            vel[k].push_back(p.vel[k]);
+            acc[k].push_back(p.acc[k]);
+        }
+        auto tally = [&](auto first, auto last, auto) {count[k] += last-first;};
+        for_each_inversion(vel[k],o,tally);
+        for_each_inversion(acc[k],o,tally);
+        for(std::size_t i = 0, j; i < o.size(); i = j) {
+            for(j = i+1; j < o.size() and same_motion(o[i],o[j],k); ++j);
+            count[k] += (j-i)*(j-i-1)/2;
+        }
+    }
+
+    int k = std::min_element(count.begin(),count.end()) - count.begin();
+    if(count[k] > budget) return std::nullopt;
+
+    std::vector<std::pair<std::size_t,std::size_t>> candidates;
+    auto& o = order[k];
+    for_each_inversion(vel[k],o,[&](auto first, auto last, auto j) {
+        for(; first != last; ++first) candidates.push_back({*first,j});
+    });
+    for_each_inversion(acc[k],o,[&](auto first, auto last, auto j) {
+        for(; first != last; ++first) {
+            if(ps[*first].vel[k] <= ps[j].vel[k]) candidates.push_back({*first,j});
+        }
+    });
+    for(std::size_t i = 0, j; i < o.size(); i = j) {
+        for(j = i+1; j < o.size() and same_motion(o[i],o[j],k); ++j);
+        for(auto x = i; x < j; ++x) {
+            for(auto y = x+1; y < j; ++y) candidates.push_back({o[x],o[y]});
+        }
+    }
+
+    std::vector<std::uint8_t> keep(candidates.size());
+    parallel_for(candidates.size(),[&](std::size_t, std::size_t begin, std::size_t end) {
+        for(auto c = begin; c < end; ++c) {
+            auto [i,j] = candidates[c];
+            keep[c] = not separated(ps[i],ps[j],(k+1)%3) and not separated(ps[i],ps[j],(k+2)%3);
         }
+    });
+    std::vector<std::pair<std::size_t,std::size_t>> ret;
+    for(std::size_t c = 0; c < candidates.size(); ++c) {
+        if(keep[c]) ret.push_back(candidates[c]);
+    }
+    return ret;
+}
+
+//Solves the remaining candidate pairs with the per axis quadratic and lets particles die at their first collision with a live partner
+std::size_t analytic(std::vector<Particle> ps, const std::vector<std::pair<std::size_t,std::size_t>>& pairs) {
+    std::vector<std::int64_t> times(pairs.size());
+    parallel_for(pairs.size(),[&](std::size_t, std::size_t begin, std::size_t end) {
+        for(auto c = begin; c < end; ++c) times[c] = collide(ps[pairs[c].first],ps[pairs[c].second]);
+    });
+    std::vector<CollisionEvent> collisions;
+    for(std::size_t c = 0; c < pairs.size(); ++c) {
+        if(times[c] != -1) collisions.push_back({times[c],pairs[c].first,pairs[c].second});
     }
     std::ranges::sort(collisions,{},&CollisionEvent::time);
     for(auto event : collisions) {
-        if(event.time <= input[event.p1].time_of_death && event.time <= input[event.p2].time_of_death) {
-            input[event.p1].time_of_death = event.time;
-            input[event.p2].time_of_death = event.time;
+        if(event.time <= ps[event.p1].time_of_death && event.time <= ps[event.p2].time_of_death) {
+            ps[event.p1].time_of_death = event.time;
+            ps[event.p2].time_of_death = event.time;
+        }
+    }
+    return std::count_if(ps.begin(),ps.end(),[](auto& p) {return p.time_of_death == std::numeric_limits<std::int64_t>::max();});
+}
+
+/*
+    Ticks the cloud forward, removing every group of particles that shares a position. At doubling intervals it counts the pairs that could still converge:
+    none left means the survivors are final, and once few enough are left(or after tick_limit) they are finished analytically.
+*/
+auto part2(decltype(parse("")) input, std::int64_t tick_limit = 1 << 12) {
+    std::int64_t next_check = 0;
+    for(std::int64_t tick = 0;; ++tick) {
+        auto dead = same_position(input);
+        std::sort(dead.begin(),dead.end(),std::greater{});
+        for(auto i : dead) {
+            std::swap(input[i],input.back());
+            input.pop_back();
+        }
+
+        if(tick == next_check or tick == tick_limit) {
+            auto budget = tick == tick_limit ? std::numeric_limits<std::size_t>::max() : 8*input.size();
+            if(auto pairs = converging_pairs(input,budget)) {
+                return pairs->empty() ? input.size() : analytic(std::move(input),*pairs);
+            }
+            next_check = 2*next_check+1;
         }
+
+        parallel_for(input.size(),[&](std::size_t, std::size_t begin, std::size_t end) {
+            for(auto i = begin; i < end; ++i) {
+                auto& p = input[i];
+                for(int k = 0; k < 3; ++k) {
+                    p.vel[k] += p.acc[k];
+                    p.pos[k] += p.vel[k];
+                }
+            }
+        });
     }
-    return std::count_if(input.begin(),input.end(),[](auto p) {return p.time_of_death == std::numeric_limits<int>::max();});
 }
 
 void solution(std::string_view input) {
     auto in = parse(input);
     std::cout << "Part 1: " << part1(in) << '\n';
-    std::cout << "Part 2: " << part2(std::move(in));
+    std::cout << "Part 2: " << part2(std::move(in)) << '\n';
 }
 
 std::string_view input = R"(p=<-1724,-1700,5620>, v=<44,-10,-107>, a=<2,6,-9>
@@ -8,6 +8,8 @@
 #include <bit>
 #include <numeric>
 #include <algorithm>
+#include <vector>
+#include <cstdint>
 
 template<typename F>
 void split(std::string_view in, char delim, F&& f) {
@@ -190,32 +192,100 @@ auto parse(std::string_view input) {
 }
 
 
-auto part1(const RuleSet& rules) {
-    int start = grid3::minNum(to_int(".#./..#/###"));
-    auto& startRule = rules.find(start);
-
-    //step 1: rule->rhs
-    //step 2: rule->rhs2
-    //step 3: small[rule->rhs2]
-    //step 4: small[rule->rhs2]->rhs
-    //step 5: small[rule->rhs2]->rhs2
-    auto step2 = startRule.rhs2;
-    
-    std::array<int,step2.size()> step3;
-    std::ranges::transform(step2,step3.begin(),[&](int n) {return rules.small[n];});
-    
-    std::array<int,step2.size()> step5;
-    std::ranges::transform(step3,step5.begin(),[&rules](int n) {
-        auto s5 = rules.find(n).rhs2;
-        return std::accumulate(s5.begin(),s5.end(),0,[](auto acc, int s) {return acc + std::bitset<4>(s).count();});
-    });
+/*
+    After three iterations a 3x3 block has become a 9x9 grid that splits into nine 3x3 blocks, and those never interact again.
+    So the image only needs to be tracked as a histogram over canonical 3x3 blocks(one per rule), advanced three iterations at a time.
+    The leftover 0-2 iterations are read off per block: its own pixels, its rule's 4x4 output or the 6x6 after that.
+    Counts are kept modulo a given modulus, 0 meaning modulo 2^64(exact as long as they fit, which is around 60 iterations).
+*/
+class Fractal {
+    std::vector<std::array<std::uint16_t,9>> next;
+    std::vector<std::array<std::uint64_t,3>> lit;
+    std::uint16_t start;
+    std::uint64_t modulus;
 
-    return std::accumulate(step5.begin(),step5.end(),0);
-}
+    using Matrix = std::vector<std::vector<std::uint64_t>>;
+
+    std::uint64_t reduce(unsigned __int128 x) const {
+        return modulus ? std::uint64_t(x % modulus) : std::uint64_t(x);
+    }
+
+    std::vector<std::uint64_t> advance(const std::vector<std::uint64_t>& hist) const {
+        std::vector<std::uint64_t> ret(hist.size());
+        for(std::size_t b = 0; b < hist.size(); ++b) {
+            if(hist[b] == 0) continue;
+            for(auto n : next[b]) ret[n] = reduce((unsigned __int128)ret[n] + hist[b]);
+        }
+        return ret;
+    }
+
+    Matrix multiply(const Matrix& a, const Matrix& b) const {
+        auto n = a.size();
+        Matrix ret(n,std::vector<std::uint64_t>(n));
+        for(std::size_t i = 0; i < n; ++i) {
+            for(std::size_t k = 0; k < n; ++k) {
+                if(a[i][k] == 0) continue;
+                for(std::size_t j = 0; j < n; ++j) {
+                    ret[i][j] = reduce(ret[i][j] + (unsigned __int128)a[i][k]*b[k][j]);
+                }
+            }
+        }
+        return ret;
+    }
+
+    //Histogram after steps rounds of three iterations, by squaring the transition matrix once there are more rounds than blocks
+    std::vector<std::uint64_t> histogram(std::uint64_t steps) const {
+        std::vector<std::uint64_t> hist(next.size());
+        hist[start] = 1;
+        if(steps <= next.size()) {
+            for(std::uint64_t i = 0; i < steps; ++i) hist = advance(hist);
+            return hist;
+        }
+        Matrix power(next.size(),std::vector<std::uint64_t>(next.size()));
+        for(std::size_t b = 0; b < next.size(); ++b) {
+            for(auto n : next[b]) power[b][n]++;
+        }
+        for(; steps; steps >>= 1, power = multiply(power,power)) {
+            if(steps & 1) {
+                std::vector<std::uint64_t> ret(hist.size());
+                for(std::size_t i = 0; i < hist.size(); ++i) {
+                    if(hist[i] == 0) continue;
+                    for(std::size_t j = 0; j < hist.size(); ++j) ret[j] = reduce(ret[j] + (unsigned __int128)hist[i]*power[i][j]);
+                }
+                hist = std::move(ret);
+            }
+        }
+        return hist;
+    }
+
+public:
+    Fractal(const RuleSet& rules, int start_grid, std::uint64_t modulus = 0): next(rules.rules.size()), lit(rules.rules.size()), modulus(modulus) {
+        auto index = [&rules](int grid) {
+            return std::uint16_t(&rules.find(grid) - rules.rules.data());
+        };
+        for(std::size_t b = 0; b < rules.rules.size(); ++b) {
+            auto& r = rules.rules[b];
+            lit[b] = {std::uint64_t(std::popcount(unsigned(r.lhs))),std::uint64_t(std::popcount(unsigned(r.actual_rhs))),std::uint64_t(std::popcount(r.rhs2_full))};
+            std::ranges::transform(r.rhs2,next[b].begin(),[&](int n) {return index(rules.small[n]);});
+        }
+        start = index(start_grid);
+    }
+
+    std::uint64_t pixels(std::uint64_t iterations) const {
+        auto hist = histogram(iterations/3);
+        std::uint64_t total = 0;
+        for(std::size_t b = 0; b < hist.size(); ++b) {
+            total = reduce(total + (unsigned __int128)hist[b]*lit[b][iterations%3]);
+        }
+        return total;
+    }
+};
 
 void solution(std::string_view input) {
     auto rules = parse(input);
-    std::cout << "Part 1: " << part1(rules) << '\n';
+    Fractal fractal(rules,to_int(".#./..#/###"));
+    std::cout << "Part 1: " << fractal.pixels(5) << '\n';
+    std::cout << "Part 2: " << fractal.pixels(18) << '\n';
 }
 
 std::string_view input = R"(../.. => .##/..#/##.
@@ -0,0 +1,156 @@
+#pragma once
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <span>
+#include <utility>
+#include <algorithm>
+#include <cstdint>
+
+//Shared union-find for Day12 and Day14
+
+//Union by rank with path halving, sets are created one at a time with newSet
+class DisjointSets {
+    std::vector<std::uint32_t> parent;
+    std::vector<std::uint32_t> sizes;
+    std::vector<std::uint8_t> rank;
+    std::size_t total_sets = 0;
+
+public:
+    DisjointSets() = default;
+    explicit DisjointSets(std::size_t n) {
+        for(std::size_t i = 0; i < n; ++i) newSet();
+    }
+
+    std::size_t newSet() {
+        parent.push_back(parent.size());
+        sizes.push_back(1);
+        rank.push_back(0);
+        total_sets++;
+        return parent.back();
+    }
+
+    //Every node visited is pointed at its grandparent, which halves the path without a second pass
+    std::size_t findRoot(std::size_t n) {
+        while(parent[n] != n) {
+            parent[n] = parent[parent[n]];
+            n = parent[n];
+        }
+        return n;
+    }
+
+    //Returns the root of the merged set
+    std::size_t merge(std::size_t x, std::size_t y) {
+        x = findRoot(x);
+        y = findRoot(y);
+        if(x == y) return x;
+
+        if(rank[x] < rank[y]) std::swap(x,y);
+        parent[y] = x;
+        sizes[x] += sizes[y];
+        rank[x] += rank[x] == rank[y];
+        total_sets--;
+        return x;
+    }
+
+    bool same(std::size_t x, std::size_t y) {
+        return findRoot(x) == findRoot(y);
+    }
+
+    std::size_t size(std::size_t n) {
+        return sizes[findRoot(n)];
+    }
+
+    std::size_t count() const {
+        return total_sets;
+    }
+};
+
+/*
+    Lock-free union-find over a fixed number of elements, for merging edges from many threads at once.
+    A root is only ever linked by a CAS on its own parent and always under a root with a larger index, so no cycle can form.
+    Path halving is done with a CAS as well, losing it to another thread is harmless since both writes point further up the same path.
+    Component sizes are pushed up to the new root after a link. While merges are still running a size is a lower bound, once they stop it is exact.
+*/
+class ConcurrentDisjointSets {
+    std::vector<std::atomic<std::uint32_t>> parent;
+    std::vector<std::atomic<std::uint32_t>> sizes;
+    std::atomic<std::size_t> total_sets;
+
+    //Adds amount to the root above n. If that root got linked meanwhile whatever it holds is moved on, so nothing stays behind on a non-root.
+    //The size update and the parent check here against the link and the size exchange in merge are all seq_cst:
+    //either the exchange in merge sees the amount added here or the check here sees the link
+    void add_size(std::uint32_t n, std::uint32_t amount) {
+        while(amount) {
+            n = findRoot(n);
+            sizes[n].fetch_add(amount,std::memory_order_seq_cst);
+            if(parent[n].load(std::memory_order_seq_cst) == n) return;
+            amount = sizes[n].exchange(0,std::memory_order_seq_cst);
+        }
+    }
+
+public:
+    explicit ConcurrentDisjointSets(std::size_t n): parent(n), sizes(n), total_sets(n) {
+        for(std::size_t i = 0; i < n; ++i) {
+            parent[i].store(i,std::memory_order_relaxed);
+            sizes[i].store(1,std::memory_order_relaxed);
+        }
+    }
+
+    std::uint32_t findRoot(std::uint32_t n) {
+        while(true) {
+            auto p = parent[n].load(std::memory_order_acquire);
+            if(p == n) return n;
+            auto grandparent = parent[p].load(std::memory_order_acquire);
+            if(p != grandparent) parent[n].compare_exchange_weak(p,grandparent,std::memory_order_release,std::memory_order_relaxed);
+            n = grandparent;
+        }
+    }
+
+    //Returns false if x and y were already in the same set
+    bool merge(std::uint32_t x, std::uint32_t y) {
+        while(true) {
+            x = findRoot(x);
+            y = findRoot(y);
+            if(x == y) return false;
+            if(x > y) std::swap(x,y);
+            auto expected = x;
+            if(parent[x].compare_exchange_strong(expected,y,std::memory_order_seq_cst)) {
+                total_sets.fetch_sub(1,std::memory_order_relaxed);
+                add_size(y,sizes[x].exchange(0,std::memory_order_seq_cst));
+                return true;
+            }
+        }
+    }
+
+    //A root that is still a root after both finds proves the answer at that moment
+    bool same(std::uint32_t x, std::uint32_t y) {
+        while(true) {
+            x = findRoot(x);
+            y = findRoot(y);
+            if(x == y) return true;
+            if(parent[x].load(std::memory_order_acquire) == x) return false;
+        }
+    }
+
+    std::size_t size(std::uint32_t n) {
+        return sizes[findRoot(n)].load(std::memory_order_relaxed);
+    }
+
+    std::size_t count() const {
+        return total_sets.load(std::memory_order_relaxed);
+    }
+
+    //Merges a batch of edges, split evenly over the available threads
+    void merge_batch(std::span<const std::pair<std::uint32_t,std::uint32_t>> edges) {
+        std::size_t num_threads = std::clamp<std::size_t>(edges.size()/(1 << 16),1,std::max(1u,std::thread::hardware_concurrency()));
+        std::size_t chunk = (edges.size() + num_threads - 1) / num_threads;
+        auto worker = [&](std::size_t t) {
+            for(auto i = t*chunk; i < std::min(edges.size(),(t+1)*chunk); ++i) merge(edges[i].first,edges[i].second);
+        };
+        std::vector<std::thread> threads;
+        for(std::size_t t = 1; t < num_threads; ++t) threads.emplace_back(worker,t);
+        worker(0);
+        for(auto& t : threads) t.join();
+    }
+};
@@ -0,0 +1,117 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <array>
+#include <vector>
+#include <span>
+#include <numeric>
+#include <algorithm>
+#include <thread>
+#include <cstring>
+#include <cstdint>
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#endif
+
+//Shared knot hash for Day10 and Day14
+namespace KnotHash {
+    using u128 = unsigned __int128;
+    using State = std::array<unsigned char,256>;
+
+    constexpr std::array<unsigned char,5> suffix{17,31,73,47,23};
+
+    //Reverses [0,n), swapping 16 byte blocks from both ends with a byte shuffle while they don't overlap
+    inline void reverse_prefix(unsigned char* p, std::size_t n) {
+        std::size_t i = 0, j = n;
+#ifdef __SSSE3__
+        const auto reverse = _mm_setr_epi8(15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0);
+        for(; j - i >= 32; i += 16, j -= 16) {
+            auto front = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p+i));
+            auto back = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p+j-16));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p+i),_mm_shuffle_epi8(back,reverse));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p+j-16),_mm_shuffle_epi8(front,reverse));
+        }
+#endif
+        std::reverse(p+i,p+j);
+    }
+
+    /*
+        The state is kept rotated so the current position is always index 0, which makes every reversal a contiguous prefix.
+        Moving the position forward is a rotation, done as two memcpys into a second buffer. offset tracks where index 0 sits in the real list.
+    */
+    inline State sparse(std::span<const unsigned char> lengths, int rounds) {
+        alignas(16) State a, b;
+        std::iota(a.begin(),a.end(),0);
+        unsigned char* current = a.data();
+        unsigned char* next = b.data();
+        std::size_t offset = 0, skip = 0;
+        for(int round = 0; round < rounds; ++round) {
+            for(std::size_t length : lengths) {
+                reverse_prefix(current,length);
+                auto r = (length + skip++) % 256;
+                std::memcpy(next,current+r,256-r);
+                std::memcpy(next+256-r,current,r);
+                std::swap(current,next);
+                offset = (offset + r) % 256;
+            }
+        }
+        State ret;
+        std::memcpy(ret.data()+offset,current,256-offset);
+        std::memcpy(ret.data(),current+256-offset,offset);
+        return ret;
+    }
+
+    //First byte of the dense hash ends up in the most significant bits
+    inline u128 dense(const State& s) {
+        u128 ret = 0;
+        for(int block = 0; block < 16; ++block) {
+            unsigned char x = 0;
+            for(int i = 0; i < 16; ++i) x ^= s[block*16+i];
+            ret = (ret << 8) | x;
+        }
+        return ret;
+    }
+
+    //key must already have the standard suffix appended
+    inline u128 hash_lengths(std::span<const unsigned char> key) {
+        return dense(sparse(key,64));
+    }
+
+    inline u128 hash(std::string_view key) {
+        std::string lengths{key};
+        lengths.append(suffix.begin(),suffix.end());
+        return hash_lengths({reinterpret_cast<const unsigned char*>(lengths.data()),lengths.size()});
+    }
+
+    /*
+        Hashes keys 0..count-1 across threads. make_key(i,buffer) fills a per-thread buffer that is reused between keys, so no key allocates once the buffer has grown.
+    */
+    template<typename F>
+    std::vector<u128> hash_batch(std::size_t count, F&& make_key) {
+        std::vector<u128> ret(count);
+        std::size_t num_threads = std::clamp<std::size_t>(count/64,1,std::max(1u,std::thread::hardware_concurrency()));
+        std::size_t chunk = (count + num_threads - 1) / num_threads;
+        auto worker = [&](std::size_t t) {
+            std::string buffer;
+            for(auto i = t*chunk; i < std::min(count,(t+1)*chunk); ++i) {
+                buffer.clear();
+                make_key(i,buffer);
+                buffer.append(suffix.begin(),suffix.end());
+                ret[i] = hash_lengths({reinterpret_cast<const unsigned char*>(buffer.data()),buffer.size()});
+            }
+        };
+        std::vector<std::thread> threads;
+        for(std::size_t t = 1; t < num_threads; ++t) threads.emplace_back(worker,t);
+        worker(0);
+        for(auto& t : threads) t.join();
+        return ret;
+    }
+
+    inline std::string to_hex(u128 h) {
+        std::string ret(32,'0');
+        for(int i = 31; i >= 0; --i, h >>= 4) {
+            ret[i] = "0123456789abcdef"[h & 0xf];
+        }
+        return ret;
+    }
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <vector>
+#include <span>
+#include <bit>
+#include <cstdint>
+#include "disjoint_sets.h"
+
+/*
+    Counts 4-connected regions of set bits in a bitmap fed one row at a time, bit i of a row being bit i%64 of word i/64.
+    Each row is cut into horizontal runs with ctz, jumping straight from one run boundary to the next, and a run that reaches the top
+    of a word continues into the next one. Every run gets a set, and only runs overlapping a run of the row above are merged,
+    found with a two pointer sweep over both sorted run lists. All work is per run, a row of empty or full words costs one step per word.
+*/
+class RegionLabeller {
+    struct Run {
+        std::size_t begin, end;
+        std::size_t set;
+    };
+
+    DisjointSets sets;
+    std::vector<Run> above, current;
+    std::size_t pixels = 0;
+
+public:
+    void add_row(std::span<const std::uint64_t> row) {
+        current.clear();
+        for(std::size_t w = 0; w < row.size(); ++w) {
+            auto word = row[w];
+            std::size_t base = w*64;
+            while(word) {
+                int start = std::countr_zero(word);
+                int length = std::countr_one(word >> start);
+                if(not current.empty() and current.back().end == base + start) {
+                    current.back().end += length;
+                } else {
+                    current.push_back({base+start,base+start+length,0});
+                }
+                pixels += length;
+                if(start + length == 64) break;
+                word &= ~std::uint64_t(0) << (start + length);
+            }
+        }
+
+        for(auto& r : current) r.set = sets.newSet();
+        for(std::size_t a = 0, c = 0; a < above.size() and c < current.size();) {
+            if(above[a].begin < current[c].end and current[c].begin < above[a].end) {
+                sets.merge(above[a].set,current[c].set);
+            }
+            if(above[a].end < current[c].end) ++a;
+            else ++c;
+        }
+        std::swap(above,current);
+    }
+
+    std::size_t regions() const {
+        return sets.count();
+    }
+
+    std::size_t area() const {
+        return pixels;
+    }
+};
@@ -1,94 +1,192 @@
 #include <array>
-#include <tuple>
 #include <iostream>
-#include <deque>
 #include <vector>
+#include <span>
+#include <optional>
+#include <map>
+#include <utility>
 #include <algorithm>
+#include <bit>
+#include <cstdint>
+#include "intcode.h"
+#include "thread_pool.h"
 
 std::array storage = {3,8,1001,8,10,8,105,1,0,0,21,42,55,64,85,98,179,260,341,422,99999,3,9,101,2,9,9,102,5,9,9,1001,9,2,9,1002,9,5,9,4,9,99,3,9,1001,9,5,9,1002,9,4,9,4,9,99,3,9,101,3,9,9,4,9,99,3,9,1002,9,4,9,101,3,9,9,102,5,9,9,101,4,9,9,4,9,99,3,9,1002,9,3,9,1001,9,3,9,4,9,99,3,9,1002,9,2,9,4,9,3,9,101,1,9,9,4,9,3,9,101,1,9,9,4,9,3,9,1002,9,2,9,4,9,3,9,101,1,9,9,4,9,3,9,101,1,9,9,4,9,3,9,101,2,9,9,4,9,3,9,1001,9,1,9,4,9,3,9,1002,9,2,9,4,9,3,9,1001,9,2,9,4,9,99,3,9,1002,9,2,9,4,9,3,9,101,2,9,9,4,9,3,9,1001,9,2,9,4,9,3,9,101,2,9,9,4,9,3,9,102,2,9,9,4,9,3,9,1002,9,2,9,4,9,3,9,101,1,9,9,4,9,3,9,1002,9,2,9,4,9,3,9,102,2,9,9,4,9,3,9,101,2,9,9,4,9,99,3,9,1002,9,2,9,4,9,3,9,1002,9,2,9,4,9,3,9,101,1,9,9,4,9,3,9,1001,9,2,9,4,9,3,9,1002,9,2,9,4,9,3,9,101,1,9,9,4,9,3,9,101,2,9,9,4,9,3,9,101,2,9,9,4,9,3,9,102,2,9,9,4,9,3,9,102,2,9,9,4,9,99,3,9,102,2,9,9,4,9,3,9,102,2,9,9,4,9,3,9,1001,9,2,9,4,9,3,9,1001,9,1,9,4,9,3,9,1001,9,1,9,4,9,3,9,101,1,9,9,4,9,3,9,1002,9,2,9,4,9,3,9,101,2,9,9,4,9,3,9,1002,9,2,9,4,9,3,9,1002,9,2,9,4,9,99,3,9,1001,9,1,9,4,9,3,9,102,2,9,9,4,9,3,9,1001,9,1,9,4,9,3,9,1002,9,2,9,4,9,3,9,1002,9,2,9,4,9,3,9,101,2,9,9,4,9,3,9,1001,9,1,9,4,9,3,9,1002,9,2,9,4,9,3,9,102,2,9,9,4,9,3,9,102,2,9,9,4,9,99};
 
-struct ins {
-    int op;
-    std::array<bool,3> modes;
+//The link between two amplifiers holds a single value, a sender with a full mailbox waits for the receiver to take it
+struct Mailbox {
+    std::int64_t value = 0;
+    bool full = false;
 };
 
-ins decode(int instruction) {
-    return {instruction % 100, {instruction / 100 % 2 == 1, instruction / 1'000 % 2 == 1, instruction / 10'000 % 2 == 1}};
-}
+/*
+    Finds the best ordering of phase settings for a chain of any number of amplifiers.
+    Every amplifier starts by reading its phase, so the program is run up to its first signal input once per phase(primed),
+    and each evaluation resets a pooled amplifier from that instead of building a new one. Pools are per thread and keep their memory between resets.
 
-struct RunResult {
-    int result;
-    bool input_requested;
-};
+    Serial chains are searched depth first over prefixes, so the signal out of a prefix is computed once and shared by every ordering that starts with it.
+    A prefix that doesn't produce a signal cuts off its subtree, and (remaining phases, signal) pairs already solved are looked up instead of searched again.
+    Feedback chains only have a result once the whole loop has run, so those permutations are evaluated one by one, in batches spread over the pool.
+    Phase sets are sets of indices into a bitmask and permutations are ranked in 64 bits, which allows chains of up to 20 amplifiers.
+*/
+class PhaseSearch {
+        //Best signal out of the rest of the chain per (remaining phases, signal in)
+        using Solved = std::map<std::pair<std::uint32_t,std::int64_t>,std::optional<std::int64_t>>;
 
-class Amplifier {
     public:
-        Amplifier(int phase) : inputs{phase} {};
-        RunResult run(int input) {
-            inputs.push_back(input);
-            std::array sizes = {0,4,4,2,2,3,3,4,4};
-            int out = 0;
-            while(loc < prog.size() and prog[loc] != 99) {
-                auto [op,modes] = decode(prog[loc]);
-                auto fetch = [&](int num) -> int& {
-                    return modes[num-1] ? prog[loc+num] : prog[prog[loc + num]];
-                };
-                switch(op) {
-                    case 1:
-                        fetch(3) = fetch(1) + fetch(2);
-                        break;
-                    case 2:
-                        fetch(3) = fetch(1) * fetch(2);
-                        break;
-                    case 3:
-                        if(inputs.empty()) {
-                            return {out,true};
-                        }
-                        fetch(1) = inputs.front();
-                        inputs.pop_front();
-                        break;
-                    case 4:
-                        out = fetch(1);
-                        break;
-                    case 5:
-                        if(fetch(1)) loc = fetch(2) - 3;
-                        break;
-                    case 6:
-                        if(not fetch(1)) loc = fetch(2) - 3;
-                        break;
-                    case 7:
-                        fetch(3) = fetch(1) < fetch(2);
-                        break;
-                    case 8:
-                        fetch(3) = fetch(1) == fetch(2);
-                        break;
+        PhaseSearch(const IntCode::Storage& program, ThreadPool& pool) : pool(pool), base(program) {}
+
+        //Highest signal out of a single pass through the chain, the phases being a permutation of phases
+        std::optional<std::int64_t> best_serial(const std::vector<int>& phases) {
+            prime(phases);
+            std::vector<std::optional<std::int64_t>> best(phases.size());
+            std::uint32_t all = (std::uint32_t(1) << phases.size()) - 1;
+            pool.for_each(phases.size(),[&](std::size_t first) {
+                auto& amp = amplifiers(1)[0];
+                Solved solved;
+                if(auto signal = pass(amp,first,0)) best[first] = serial(amp,solved,all & ~(std::uint32_t(1) << first),*signal);
+            });
+            return maximum(best);
+        }
+
+        //Highest signal the last amplifier sends back into the first before the chain halts
+        std::optional<std::int64_t> best_feedback(const std::vector<int>& phases) {
+            prime(phases);
+            std::size_t n = phases.size();
+            std::uint64_t permutations = 1;
+            for(std::size_t i = 2; i <= n; ++i) permutations *= i;
+            std::size_t batches = (permutations + batch_size - 1) / batch_size;
+            std::vector<std::optional<std::int64_t>> best(batches);
+            pool.for_each(batches,[&](std::size_t b) {
+                auto amps = amplifiers(n);
+                std::vector<std::size_t> order(n);
+                for(auto i = b*batch_size; i < std::min(permutations,(b+1)*batch_size); ++i) {
+                    unrank(i,order);
+                    auto r = feedback(amps,order);
+                    if(r and (not best[b] or *r > *best[b])) best[b] = r;
                 }
-                loc += sizes[op];
-            }
-            return {out,false};
+            });
+            return maximum(best);
         }
+
     private:
-        decltype(storage) prog = storage;
-        int loc = 0;
-        std::deque<int> inputs;
-};
+        static constexpr std::uint64_t batch_size = 64;
 
-int run(std::array<int,5> phase_settings) {
-    int res = 0;
-    do {
-        RunResult r = {0,true};
-        std::vector<Amplifier> amps(phase_settings.begin(),phase_settings.end());
-        while(r.input_requested) {
-            for(auto& amp : amps) {
-                r = amp.run(r.result);
+        ThreadPool& pool;
+        IntCode::Program base;
+        std::vector<IntCode::Program> primed;
+
+        void prime(const std::vector<int>& phases) {
+            primed.clear();
+            for(auto phase : phases) {
+                primed.push_back(base.fork());
+                primed.back().input.push(phase);
+                primed.back().run();
             }
         }
-        res = std::max(r.result,res);
-    } while(std::next_permutation(phase_settings.begin(),phase_settings.end()));
-    return res;
-}
+
+        static std::span<IntCode::Program> amplifiers(std::size_t n) {
+            thread_local std::vector<IntCode::Program> amps;
+            while(amps.size() < n) amps.emplace_back(IntCode::Storage());
+            return {amps.data(),n};
+        }
+
+        static std::optional<std::int64_t> maximum(const std::vector<std::optional<std::int64_t>>& values) {
+            std::optional<std::int64_t> ret;
+            for(auto& v : values) {
+                if(v and (not ret or *v > *ret)) ret = v;
+            }
+            return ret;
+        }
+
+        //Phase indices of the i-th permutation in lexicographic order
+        static void unrank(std::uint64_t i, std::vector<std::size_t>& order) {
+            std::size_t n = order.size();
+            std::vector<std::uint64_t> factorial(n,1);
+            for(std::size_t k = 1; k < n; ++k) factorial[k] = factorial[k-1]*k;
+            std::uint32_t left = (std::uint32_t(1) << n) - 1;
+            for(std::size_t k = 0; k < n; ++k) {
+                auto skip = i / factorial[n-1-k];
+                i %= factorial[n-1-k];
+                auto bits = left;
+                while(skip--) bits &= bits - 1;
+                order[k] = std::countr_zero(bits);
+                left &= ~(std::uint32_t(1) << order[k]);
+            }
+        }
+
+        //The last signal the amplifier with phase index p outputs for the given input
+        std::optional<std::int64_t> pass(IntCode::Program& amp, std::size_t p, std::int64_t signal) {
+            amp.reset(primed[p]);
+            amp.input.push(signal);
+            amp.run();
+            std::optional<std::int64_t> out;
+            while(not amp.output.empty()) out = amp.output.pop();
+            return out;
+        }
+
+        std::optional<std::int64_t> serial(IntCode::Program& amp, Solved& solved,
+                                           std::uint32_t remaining, std::int64_t signal) {
+            if(remaining == 0) return signal;
+            auto key = std::pair{remaining,signal};
+            if(auto it = solved.find(key); it != solved.end()) return it->second;
+
+            std::optional<std::int64_t> best;
+            for(auto bits = remaining; bits; bits &= bits - 1) {
+                auto p = std::countr_zero(bits);
+                auto next = pass(amp,p,signal);
+                if(not next) continue;
+                auto r = serial(amp,solved,remaining & ~(std::uint32_t(1) << p),*next);
+                if(r and (not best or *r > *best)) best = r;
+            }
+            solved[key] = best;
+            return best;
+        }
+
+        //Runs the loop round robin, every amplifier going until it blocks on an empty inbox, a full outbox or halts
+        std::optional<std::int64_t> feedback(std::span<IntCode::Program> amps, const std::vector<std::size_t>& order) {
+            std::size_t n = amps.size();
+            std::array<Mailbox,32> mail{};
+            std::uint32_t halted = 0;
+            std::optional<std::int64_t> last;
+            for(std::size_t i = 0; i < n; ++i) amps[i].reset(primed[order[i]]);
+            mail[0] = {0,true};
+
+            while(true) {
+                bool progress = false;
+                for(std::size_t i = 0; i < n; ++i) {
+                    auto& amp = amps[i];
+                    auto& in = mail[i];
+                    auto& out = mail[(i+1) % n];
+                    while(true) {
+                        if(not amp.output.empty()) {
+                            if(out.full and not (halted >> (i+1) % n & 1)) break;
+                            out = {amp.output.pop(),true};
+                            if(i == n-1) last = out.value;
+                            progress = true;
+                            continue;
+                        }
+                        if(halted >> i & 1) break;
+                        auto status = amp.run_until_io();
+                        if(status == IntCode::Status::NeedInput) {
+                            if(not in.full) break;
+                            amp.input.push(in.value);
+                            in.full = false;
+                        } else if(status == IntCode::Status::Halted) {
+                            halted |= std::uint32_t(1) << i;
+                        }
+                        progress = true;
+                    }
+                }
+                if(halted == (std::uint32_t(1) << n) - 1) return last;
+                if(not progress) return std::nullopt;
+            }
+        }
+};
 
 int main() {
-    std::cout << "Part 1: " << run({0,1,2,3,4}) << '\n';
-    std::cout << "Part 2: " << run({5,6,7,8,9}) << '\n';
+    ThreadPool pool;
+    PhaseSearch search(std::vector<std::int64_t>(storage.begin(),storage.end()),pool);
+    std::cout << "Part 1: " << search.best_serial({0,1,2,3,4}).value_or(0) << '\n';
+    std::cout << "Part 2: " << search.best_feedback({5,6,7,8,9}).value_or(0) << '\n';
 }
@@ -6,112 +6,8 @@
 #include <unordered_map>
 #include <cstdint>
 #include <complex>
-
-namespace IntCode {
-    struct Storage {
-        std::vector<std::int64_t> main;
-        std::map<std::int64_t,std::int64_t> extra{};
-        std::int64_t& operator[](std::size_t loc) {
-            return loc < main.size() ? main[loc] : extra[loc];
-        }
-    };
-
-    struct ins {
-        std::int64_t op;
-        std::array<std::int64_t,3> modes;
-    };
-
-    ins decode(std::int64_t instruction) {
-        return {instruction % 100, {instruction / 100 % 10, instruction / 1000 % 10, instruction / 10000 % 10}};
-    }
-
-    class Program {
-        public:
-            Program(Storage s) : prog(s) {};
-            struct RunResult {
-                std::vector<std::int64_t> output;
-                bool input_requested;
-            };
-            RunResult run(std::deque<std::int64_t> input) {
-                std::array sizes = {0,4,4,2,2,3,3,4,4,2};
-                std::vector<std::int64_t> output;
-                while(prog[loc] != 99) {
-                    auto [op,modes] = decode(prog[loc]);
-                    auto fetch = [&,modes=modes](std::int64_t num) -> std::int64_t& {
-                        auto& address = prog[loc+num];
-                        switch(modes[num-1]) {
-                            case 0:
-                                return prog[address];
-                            case 1:
-                                return address;
-                            case 2:
-                                return prog[address+relative_base];
-                        }
-                        return modes[num-1] ? prog[loc+num] : prog[prog[loc + num]];
-                    };
-                    switch(op) {
-                        case 1:
-                            fetch(3) = fetch(1) + fetch(2);
-                            break;
-                        case 2:
-                            fetch(3) = fetch(1) * fetch(2);
-                            break;
-                        case 3:
-                            if(input.empty()) return {output,true};
-                            fetch(1) = input.front();
-                            input.pop_front();
-                            break;
-                        case 4:
-                            output.push_back(fetch(1));
-                            break;
-                        case 5:
-                            if(fetch(1)) loc = fetch(2) - 3;
-                            break;
-                        case 6:
-                            if(not fetch(1)) loc = fetch(2) - 3;
-                            break;
-                        case 7:
-                            fetch(3) = fetch(1) < fetch(2);
-                            break;
-                        case 8:
-                            fetch(3) = fetch(1) == fetch(2);
-                            break;
-                        case 9:
-                            relative_base += fetch(1);
-                            break;
-                    }
-                    loc += sizes[op];
-                }
-                return {output,false};
-            }
-        private:
-            Storage prog;
-            std::size_t loc = 0;
-            std::int64_t relative_base = 0;
-    };
-
-    template<typename InputFunc, typename OutputFunc>
-    void run(Storage prog, InputFunc&& input, OutputFunc&& out) {
-        Program p(std::move(prog));
-        Program::RunResult res = p.run({});
-        for(auto o : res.output) out(o);
-        while(res.input_requested) {
-            res = p.run({input()});
-            for(auto o : res.output) out(o);
-        }
-    }
-
-    template<int N, typename F>
-    auto output_every(F output) {
-        return [output, a = std::array<std::int64_t,N>{},current=0](std::int64_t in) mutable {
-            a[current++] = in;
-            if(current == N) {
-                std::apply(output,a);
-                current = 0;
-            }
-        };
-    }
-}
+#include <algorithm>
+#include "intcode.h"
 
 void solution(IntCode::Storage p) {
     auto num_blocks = 0;
@@ -141,7 +37,7 @@ void solution(IntCode::Storage p) {
     std::int64_t score = 0;
     std::int64_t ball_x = 0;
     std::int64_t paddle_x = 0;
-    p.main[0] = 2;
+    p[0] = 2;
     IntCode::run(p,[&](){
             if(ball_x < paddle_x) return -1;
             else if(ball_x > paddle_x) return 1;
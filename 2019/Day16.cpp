@@ -1,76 +1,135 @@
-#include <array>
 #include <iostream>
-#include <iterator>
 #include <vector>
-#include <cassert>
-#include <numeric>
 #include <string_view>
+#include <algorithm>
+#include <numeric>
+#include <cstdint>
+#include <cstdlib>
+#include "thread_pool.h"
 
-template<typename It>
-It safe_next(It begin, int size, It end) {
-    if(std::distance(begin,end) < size) {
-        return end;
-    }
-    return std::next(begin,size);
-}
+/*
+    Runs FFT phases over a signal made of repeats copies of a digit string, without ever building more of it than it has to.
+    Output digit i only depends on the digits from i onwards, so only the suffix from the first wanted digit is kept.
 
-template<typename It>
-int fft(int size, It begin, It end) {
-    int total = 0;
-    int current_multiplier = 1;
-    while(begin != end) {
-        //Add up all (-)1 digits
-        It chunk = safe_next(begin,size,end);
-        total += current_multiplier * std::accumulate(begin,chunk,0);
-        //Skip zero digits
-        begin = safe_next(chunk,size,end);
-        current_multiplier *= -1;
-    }
-
-    return std::abs(total) % 10;
-}
+    Generally every phase takes prefix sums of the suffix, then digit i(run length k = i+1) is the alternating sum of
+    one difference of prefix sums per run, O(n/k) per digit and O(n log n) per phase. Digits are spread over the pool.
 
-template<typename It>
-void fft_latter_half(It rbegin, It rend) {
-    std::partial_sum(rbegin,rend,rbegin,[](auto acc, auto next) {return (acc + next) % 10;});
-}
+    From the middle of the signal onwards the pattern is all 1s past the digit, so a phase is a suffix sum and p phases
+    add up digit j with a weight of C(j-i+p-1,p-1). Those weights are taken mod 10 with Lucas' theorem mod 2 and mod 5, and only depend on
+    j-i modulo 2^a*5^b(the first powers above p-1), so both the weights and the signal repeat. Each wanted digit is one dot product over
+    a single period of both, scaled by the number of whole periods, plus the remainder.
+*/
+class FFT {
+    public:
+        FFT(std::string_view digits, std::size_t repeats, ThreadPool& pool) : base(digits.size()), repeats(repeats), pool(pool) {
+            std::transform(digits.begin(),digits.end(),base.begin(),[](char c) {return c - '0';});
+        }
 
-template<typename Arr>
-Arr fft(Arr a) {
-    for(int phase = 0; phase < 100; ++phase) {
-        for(int current_digit = 0; current_digit < a.size()/2; ++current_digit) {
-            //fft can start at current digit since all before are 0, hence we can do this in-place
-            a[current_digit] = fft(current_digit+1,a.begin()+current_digit, a.end());
+        std::size_t size() const {
+            return base.size()*repeats;
         }
-        //Second half is a reverted partial_sum
-        fft_latter_half(a.rbegin(),a.rbegin()+a.size()/2);
-    }
-    return a;
-}
 
-template<typename It>
-auto to_num(It begin, int num_digits) {
-    return std::accumulate(begin,begin+num_digits,0,[](auto acc,auto next){return acc*10+next;});
-}
+        //The count digits from offset after the given number of phases, read as a number
+        std::uint64_t window(std::size_t offset, std::size_t count, int phases) {
+            auto digits = offset >= size()/2 and phases > 0 ? by_binomials(offset,count,phases) : by_phases(offset,count,phases);
+            return std::accumulate(digits.begin(),digits.end(),std::uint64_t(0),[](auto acc, auto next) {return acc*10 + next;});
+        }
+
+        std::vector<int> by_phases(std::size_t offset, std::size_t count, int phases) {
+            std::vector<std::int32_t> signal(size() - offset);
+            for(std::size_t l = 0; l < signal.size(); ++l) signal[l] = base[(offset + l) % base.size()];
+
+            std::vector<std::int32_t> prefix(signal.size()+1);
+            std::size_t blocks = std::min<std::size_t>(signal.size(),small_blocks) + (signal.size() + block_size - 1) / block_size;
+            for(int phase = 0; phase < phases; ++phase) {
+                std::partial_sum(signal.begin(),signal.end(),prefix.begin()+1);
+                //The first digits have the shortest runs and cost the most, so they are handed out one at a time
+                pool.for_each(blocks,[&](std::size_t b) {
+                    auto first = b < small_blocks ? b : small_blocks + (b - small_blocks)*block_size;
+                    auto last = b < small_blocks ? b+1 : first + block_size;
+                    for(auto l = first; l < std::min(last,signal.size()); ++l) signal[l] = digit(prefix,l,offset + l + 1);
+                });
+            }
+            return {signal.begin(),signal.begin() + std::min(count,signal.size())};
+        }
+
+        std::vector<int> by_binomials(std::size_t offset, std::size_t count, int phases) {
+            std::size_t period = 1;
+            for(std::size_t p : {2,5}) {
+                std::size_t power = 1;
+                while(power <= std::size_t(phases-1)) power *= p;
+                period *= power;
+            }
+            std::vector<std::uint8_t> weights(std::min(std::lcm(period,base.size()),size()));
+            for(std::size_t d = 0; d < std::min(period,weights.size()); ++d) weights[d] = binomial_mod10(d + phases - 1,phases - 1);
+            for(std::size_t d = period; d < weights.size(); ++d) weights[d] = weights[d - period];
+
+            //Enough of the repeated signal for one period of weights starting at any digit of the base string
+            std::vector<std::uint8_t> tiled(weights.size() + base.size());
+            for(std::size_t j = 0; j < tiled.size(); ++j) tiled[j] = base[j % base.size()];
+
+            count = std::min(count,size() - offset);
+            std::vector<int> digits(count);
+            pool.for_each(count,[&](std::size_t d) {
+                auto i = offset + d;
+                auto dot = [&](std::size_t length) {
+                    std::uint64_t sum = 0;
+                    auto signal = tiled.begin() + i % base.size();
+                    for(std::size_t k = 0; k < length; ++k) sum += weights[k]*signal[k];
+                    return sum;
+                };
+                auto remaining = size() - i;
+                auto whole = remaining / weights.size(), rest = remaining % weights.size();
+                digits[d] = (whole % 10 * (dot(weights.size()) % 10) + dot(rest)) % 10;
+            });
+            return digits;
+        }
+
+    private:
+        static constexpr std::size_t small_blocks = 256, block_size = 64;
+
+        std::vector<std::uint8_t> base;
+        std::size_t repeats;
+        ThreadPool& pool;
+
+        //Digit l of the suffix, whose run length is k. Runs alternate +1, 0, -1, 0 from l itself
+        static std::int32_t digit(const std::vector<std::int32_t>& prefix, std::size_t l, std::size_t k) {
+            std::size_t n = prefix.size()-1;
+            std::int32_t sum = 0;
+            for(auto start = l; start < n; start += 4*k) {
+                sum += prefix[std::min(start + k,n)] - prefix[start];
+                auto negative = start + 2*k;
+                if(negative < n) sum -= prefix[std::min(negative + k,n)] - prefix[negative];
+            }
+            return std::abs(sum) % 10;
+        }
+
+        //Lucas: C(n,k) mod p is the product of the binomials of their base p digits
+        static int binomial_mod(std::size_t n, std::size_t k, int p) {
+            int ret = 1;
+            for(; k and ret; n /= p, k /= p) {
+                std::size_t nd = n % p, kd = k % p;
+                if(kd > nd) return 0;
+                int c = 1;
+                for(std::size_t j = 0; j < kd; ++j) c = c * (nd - j) / (j + 1);
+                ret = ret * c % p;
+            }
+            return ret;
+        }
+
+        //Chinese remainder: 5 is 1 mod 2 and 0 mod 5, 6 is 0 mod 2 and 1 mod 5
+        static int binomial_mod10(std::size_t n, std::size_t k) {
+            return (5*binomial_mod(n,k,2) + 6*binomial_mod(n,k,5)) % 10;
+        }
+};
 
 int main() {
     constexpr std::string_view input{"59775675999083203307460316227239534744196788252810996056267313158415747954523514450220630777434694464147859581700598049220155996171361500188470573584309935232530483361639265796594588423475377664322506657596419440442622029687655170723364080344399753761821561397734310612361082481766777063437812858875338922334089288117184890884363091417446200960308625363997089394409607215164553325263177638484872071167142885096660905078567883997320316971939560903959842723210017598426984179521683810628956529638813221927079630736290924180307474765551066444888559156901159193212333302170502387548724998221103376187508278234838899434485116047387731626309521488967864391"};
-    std::array<int,input.size()> ds;
-    std::transform(input.begin(),input.end(),ds.begin(),[](char c) {return c - '0';});
-
-    auto fft_ds = fft(ds);
-    std::cout << "Part 1: " << to_num(fft_ds.begin(),8) << '\n';
-
-    std::vector<int> next(input.size()*10000);
-    for(int i = 0; i < next.size(); ++i) {
-        next[i] = ds[i%ds.size()];
-    }
-
-    auto loc = to_num(next.begin(),7);
-    assert(loc >= next.size()/2);
-    auto rend = next.rbegin() + (next.size() - loc);
-    for(int phase = 0; phase < 100; ++phase) {
-        fft_latter_half(next.rbegin(),rend);
-    }
-    std::cout << "Part 2: " << to_num(next.begin()+loc,8) << '\n';
+    ThreadPool pool;
+    FFT once(input,1,pool);
+    std::cout << "Part 1: " << once.window(0,8,100) << '\n';
+
+    FFT real(input,10000,pool);
+    auto offset = std::accumulate(input.begin(),input.begin()+7,std::size_t(0),[](auto acc, char next) {return acc*10 + next - '0';});
+    std::cout << "Part 2: " << real.window(offset,8,100) << '\n';
 }
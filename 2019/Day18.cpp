@@ -5,11 +5,18 @@
 #include <complex>
 #include <queue>
 #include <string_view>
-#include <unordered_map>
 #include <map>
 #include <algorithm>
 #include <optional>
 #include <chrono>
+#include <deque>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <limits>
+#include <stdexcept>
+#include <cstdint>
 
 template<typename F>
 double time(F&& f, int num_tries=1) {
@@ -230,7 +237,7 @@ struct NextStates {
             std::optional<Path> ret{};
             for(auto& p : paths) {
                 if(p.possible(keys)) {
-                    if(not ret.has_value() or ret->length < p.length) {
+                    if(not ret.has_value() or p.length < ret->length) {
                         ret = p;
                     }
                 }
@@ -282,13 +289,15 @@ NextStates fromKey(const CompressedMaze& m, std::array<int,26> key_locs, int sta
     }
 
     NextStates ret;
-    std::transform(key_locs.begin(),key_locs.end(),ret.toKey.begin(),[&](int loc){return node_paths[loc];});
+    std::transform(key_locs.begin(),key_locs.end(),ret.toKey.begin(),[&](int loc){return loc < 0 ? NextStates::PathGroup{} : node_paths[loc];});
 
     return ret;
 }
 
 auto get_key_locs(const CompressedMaze& m) {
+    //-1 for letters the maze has no key for
     std::array<int,26> key_locs;
+    key_locs.fill(-1);
     for(int i = 0; i < m.nodes.size(); ++i) {
         if(m.nodes[i].dirs.isKey()) {
             key_locs[m.nodes[i].dirs.tile-'a'] = i;
@@ -297,115 +306,361 @@ auto get_key_locs(const CompressedMaze& m) {
     return key_locs;
 }
 
-std::array<NextStates,30> precompute_paths(const CompressedMaze& m) {
+//Paths from every key(by letter) and from every robot's start(26 onwards)
+std::vector<NextStates> precompute_paths(const CompressedMaze& m) {
     auto key_locs = get_key_locs(m);
 
-    std::array<NextStates,30> key_paths;
+    std::vector<NextStates> key_paths(26 + m.start.size());
     for(int i = 0; i < m.num_keys; ++i) {
         key_paths[i] = fromKey(m,key_locs,key_locs[i],i);
     }
     for(int i = 0; i < m.start.size(); ++i) {
-        key_paths[26+i] = fromKey(m,key_locs,m.start[i],i+26);
+        key_paths[26+i] = fromKey(m,key_locs,m.start[i],26);
     }
     return key_paths;
 }
 
-struct AsState {
-    std::bitset<26> keys_picked_up;
-    std::array<int,4> current_keys={26,27,28,29};
-    bool operator==(AsState o) const {
-        return keys_picked_up==o.keys_picked_up and current_keys == o.current_keys;
+constexpr std::uint32_t unreachable = std::numeric_limits<std::uint32_t>::max()/4;
+
+//Walking distances between keys and starts(same numbering as the paths) as if every door was open, a lower bound for any real path
+std::vector<std::vector<std::uint32_t>> open_distances(const CompressedMaze& m) {
+    auto key_locs = get_key_locs(m);
+    std::vector<int> locs(26 + m.start.size(),-1);
+    std::copy(key_locs.begin(),key_locs.begin()+m.num_keys,locs.begin());
+    std::copy(m.start.begin(),m.start.end(),locs.begin()+26);
+
+    std::vector<std::vector<std::uint32_t>> ret(locs.size(),std::vector<std::uint32_t>(locs.size(),unreachable));
+    for(std::size_t from = 0; from < locs.size(); ++from) {
+        if(locs[from] < 0) continue;
+        std::vector<std::uint32_t> dist(m.nodes.size(),unreachable);
+        using queue_type = std::pair<std::uint32_t,int>;
+        std::priority_queue<queue_type,std::vector<queue_type>,std::greater<>> queue;
+        queue.emplace(dist[locs[from]] = 0,locs[from]);
+        while(not queue.empty()) {
+            auto [d,n] = queue.top();
+            queue.pop();
+            if(d > dist[n]) continue;
+            m.nodes[n].for_all_paths([&,d=d](Path p, int next) {
+                if(d + p.length < dist[next]) queue.emplace(dist[next] = d + p.length,next);
+            });
+        }
+        for(std::size_t to = 0; to < locs.size(); ++to) {
+            if(locs[to] >= 0) ret[from][to] = dist[locs[to]];
+        }
+    }
+    return ret;
+}
+
+/*
+    A search state packed into 64 bits: the collected keys in the low 26 bits, then one field per robot holding 0 while it is still at its start,
+    or the key it picked up last plus one. That leaves room for up to 7 robots. Robot fields never reach all ones, so ~0 can't be a state.
+*/
+struct StateCodec {
+    int robots;
+    static constexpr int position_bits = 5;
+
+    explicit StateCodec(int robots) : robots(robots) {
+        if(26 + robots*position_bits > 64) throw std::runtime_error("Too many robots to pack a state in 64 bits");
+    }
+
+    static std::uint32_t keys(std::uint64_t s) {
+        return s & ((1u << 26) - 1);
+    }
+
+    //Index into the paths and distances of where robot r is
+    int position(std::uint64_t s, int r) const {
+        auto field = (s >> (26 + r*position_bits)) & ((1u << position_bits) - 1);
+        return field ? field - 1 : 26 + r;
+    }
+
+    std::uint64_t move(std::uint64_t s, int r, int key) const {
+        auto shift = 26 + r*position_bits;
+        s &= ~(std::uint64_t((1u << position_bits) - 1) << shift);
+        return s | std::uint64_t(key + 1) << shift | std::uint64_t(1) << key;
     }
 };
 
-namespace std {
-    template<>
-    struct hash<AsState> {
-        auto operator()(AsState s) const {
-            //State is the pickup state of the 26 keys and the locations of each explorer
-            std::bitset<26+30> combined(s.keys_picked_up.to_ulong());
-            combined <<= 30;
-            for(int i = 0; i < 4; ++i) {
-                combined.set(s.current_keys[i]);
+//Open addressing from packed states to their best known path length, linear probing in a power of two table kept at most half full
+class StateTable {
+    public:
+        static constexpr std::uint64_t empty = ~std::uint64_t(0);
+
+        std::uint32_t get(std::uint64_t s) const {
+            auto& slot = entries[find(s)];
+            return slot.state == s ? slot.length : std::numeric_limits<std::uint32_t>::max();
+        }
+
+        //Stores length for s if it is shorter than what is known, returns whether it was
+        bool improve(std::uint64_t s, std::uint32_t length) {
+            auto i = find(s);
+            if(entries[i].state == s) {
+                if(entries[i].length <= length) return false;
+                entries[i].length = length;
+                return true;
             }
-            return std::hash<decltype(combined)>{}(combined);
+            entries[i] = {s,length};
+            if(++count*2 > entries.size()) grow();
+            return true;
         }
-    };
-}
+
+        std::size_t size() const {
+            return count;
+        }
+
+        static std::uint64_t hash(std::uint64_t s) {
+            s ^= s >> 33;
+            s *= 0xff51afd7ed558ccdULL;
+            s ^= s >> 33;
+            s *= 0xc4ceb9fe1a85ec53ULL;
+            return s ^ (s >> 33);
+        }
+
+    private:
+        struct Entry {
+            std::uint64_t state = empty;
+            std::uint32_t length = 0;
+        };
+        std::vector<Entry> entries = std::vector<Entry>(1 << 10);
+        std::size_t count = 0;
+
+        std::size_t find(std::uint64_t s) const {
+            auto mask = entries.size()-1;
+            auto i = hash(s) & mask;
+            while(entries[i].state != s and entries[i].state != empty) i = (i+1) & mask;
+            return i;
+        }
+
+        void grow() {
+            auto old = std::move(entries);
+            entries.assign(old.size()*2,{});
+            for(auto& e : old) {
+                if(e.state != empty) entries[find(e.state)] = e;
+            }
+        }
+};
+
+//Priority queue for small integer priorities, a list per priority and a cursor at the lowest one that might be filled
+template<typename T>
+class BucketQueue {
+    public:
+        void push(std::size_t priority, T value) {
+            if(priority >= buckets.size()) buckets.resize(priority+1);
+            buckets[priority].push_back(value);
+            lowest = std::min(lowest,priority);
+            ++count;
+        }
+
+        //Lowest priority entry, the most recently pushed of those first
+        std::pair<std::size_t,T> pop() {
+            while(buckets[lowest].empty()) ++lowest;
+            auto value = buckets[lowest].back();
+            buckets[lowest].pop_back();
+            --count;
+            return {lowest,value};
+        }
+
+        bool empty() const {
+            return count == 0;
+        }
+
+    private:
+        std::vector<std::vector<T>> buckets;
+        std::size_t lowest = 0, count = 0;
+};
 
 struct SearchResult {
     std::size_t length, states, states_expanded;
 };
 
-SearchResult find_all_keys(const CompressedMaze& m, const std::array<NextStates,30>& paths) {
-    //Utility
-    auto for_each_path = [&](AsState s,auto&& f) {
-        for(auto current_bot = 0; current_bot < m.start.size(); ++current_bot) {
-            auto& paths_for_bot = paths[s.current_keys[current_bot]];
-            for(int key = 0; key < m.num_keys; ++key) {
-                if(not s.keys_picked_up[key]) {
-                    auto shortest = paths_for_bot.toKey[key].shortest(s.keys_picked_up);
-                    if(shortest.has_value()) {
-                        f(current_bot,key,*shortest);
-                    }
+/*
+    Hash distributed A*: every state belongs to the thread picked by its hash, which alone keeps its path length and queues it,
+    so no table or queue is shared. Successors of other threads' states are sent to them in batches.
+    The heuristic is a minimum spanning forest over the keys left, rooted at the robots: every robot's remaining walk connects its own keys to it,
+    so the walks together are at least that forest. Edge weights are the door free distances, so it never overestimates and is consistent.
+    Since threads run ahead of each other the first goal found isn't necessarily the best one. It becomes the bound every
+    state is pruned against, and the search ends once no state below it is left anywhere(pending counts states queued or in flight).
+*/
+class KeySearch {
+    public:
+        KeySearch(const CompressedMaze& m, std::size_t threads = std::max(1u,std::thread::hardware_concurrency()))
+            : m(m), paths(precompute_paths(m)), distances(open_distances(m)), codec(m.start.size()), workers(threads) {
+            goal = (std::uint32_t(1) << m.num_keys) - 1;
+        }
+
+        SearchResult run() {
+            pending = 1;
+            workers[0].insert(*this,0,0);
+            std::vector<std::thread> threads;
+            for(std::size_t t = 1; t < workers.size(); ++t) threads.emplace_back([this,t] {work(t);});
+            work(0);
+            for(auto& t : threads) t.join();
+
+            //Like before, a length of 0 when the keys can't all be collected
+            SearchResult ret{best == unreachable ? 0 : best.load(),0,0};
+            for(auto& w : workers) {
+                ret.states += w.expanded;
+                ret.states_expanded += w.table.size();
+            }
+            return ret;
+        }
+
+    private:
+        static constexpr std::size_t batch_size = 256;
+
+        struct Message {
+            std::uint64_t state;
+            std::uint32_t length;
+        };
+
+        struct Worker {
+            StateTable table;
+            BucketQueue<Message> open;
+            std::vector<std::vector<Message>> outbox;
+            std::mutex m;
+            std::condition_variable cv;
+            std::vector<Message> inbox;
+            std::size_t expanded = 0;
+
+            void insert(KeySearch& search, std::uint64_t s, std::uint32_t length) {
+                if(not table.improve(s,length)) {
+                    search.done_with_state();
+                    return;
+                }
+                if(StateCodec::keys(s) == search.goal) {
+                    auto best = search.best.load();
+                    while(length < best and not search.best.compare_exchange_weak(best,length));
+                    search.done_with_state();
+                    return;
+                }
+                auto f = length + search.heuristic(s);
+                if(f >= search.best) {
+                    search.done_with_state();
+                    return;
+                }
+                open.push(f,{s,length});
+            }
+        };
+
+        const CompressedMaze& m;
+        std::vector<NextStates> paths;
+        std::vector<std::vector<std::uint32_t>> distances;
+        StateCodec codec;
+        std::deque<Worker> workers;
+        std::uint32_t goal;
+        std::atomic<std::uint32_t> best = unreachable;
+        std::atomic<std::size_t> pending = 0;
+        std::atomic<bool> finished = false;
+
+        void done_with_state() {
+            if(pending.fetch_sub(1) == 1) {
+                finished = true;
+                for(auto& w : workers) {
+                    std::lock_guard lock(w.m);
+                    w.cv.notify_all();
                 }
             }
         }
-    };
 
-    //Heuristic is max path length of state to any other non-picked-up key
-    auto heuristic = [&,memo=std::unordered_map<AsState,std::size_t>{}](AsState s) mutable {
-        if(memo.contains(s)) return memo[s];
-        std::size_t max = 0;
-        for_each_path(s,[&](int,int,auto p) {
-            max = std::max(max,p.length);
-        });
-        memo[s] = max;
-        return max;
-    };
-    std::bitset<26> goal(std::string(m.num_keys,'1'));
-
-    std::unordered_map<AsState,std::size_t> scores;
-
-    using queue_type = std::pair<std::size_t,AsState>;
-    //Reverse ordering bc smallest needs to go out first
-    auto cmp = [](auto a, auto b) {return a.first > b.first;};
-    std::priority_queue<queue_type,std::vector<queue_type>,decltype(cmp)> AsQueue(cmp);
-    
-    auto startState = AsState{0};
-    AsQueue.emplace(heuristic(startState),startState);
-    scores[startState] = 0;
-    
-    std::size_t num_states = 0;
-    std::size_t states_expanded = 1;
-
-    while(not AsQueue.empty()) {
-        auto [fScore,state] = AsQueue.top();
-        AsQueue.pop();
-        if(fScore-heuristic(state) > scores[state]) continue;
-        num_states++;
-        if(state.keys_picked_up == goal) {
-            return {scores[state],num_states,states_expanded};
+        std::uint32_t heuristic(std::uint64_t s) const {
+            auto keys = StateCodec::keys(s);
+            std::array<std::uint32_t,26> connect;
+            std::array<int,26> left;
+            int n = 0;
+            for(int k = 0; k < m.num_keys; ++k) {
+                if(keys >> k & 1) continue;
+                left[n] = k;
+                connect[n] = unreachable;
+                for(int r = 0; r < codec.robots; ++r) connect[n] = std::min(connect[n],distances[codec.position(s,r)][k]);
+                ++n;
+            }
+            //Prim's algorithm, with all robots as the one starting tree
+            std::uint32_t total = 0;
+            while(n > 0) {
+                auto closest = std::min_element(connect.begin(),connect.begin()+n) - connect.begin();
+                //A key no robot can get to any more, the state can't be finished
+                if(connect[closest] == unreachable) return unreachable;
+                total += connect[closest];
+                auto k = left[closest];
+                --n;
+                left[closest] = left[n];
+                connect[closest] = connect[n];
+                for(int i = 0; i < n; ++i) connect[i] = std::min(connect[i],distances[k][left[i]]);
+            }
+            return total;
         }
-        auto current_len = scores[state];
-        for_each_path(state, [&,state=state](int bot, int key, auto path) {
-            auto neighbor = AsState{state.keys_picked_up,state.current_keys};
-            neighbor.keys_picked_up.set(key);
-            neighbor.current_keys[bot] = key;
-            if(not scores.contains(neighbor) or current_len+path.length < scores[neighbor]) {
-                scores[neighbor] = current_len+path.length;
-                AsQueue.emplace(current_len+path.length+heuristic(neighbor),neighbor);
-                states_expanded++;
+
+        std::size_t owner(std::uint64_t s) const {
+            return (StateTable::hash(s) >> 32) % workers.size();
+        }
+
+        void send(std::size_t from, Message msg) {
+            auto to = owner(msg.state);
+            auto& w = workers[from];
+            if(to == from) {
+                w.insert(*this,msg.state,msg.length);
+                return;
             }
-        });
-    }
-    return {};
-}
+            w.outbox[to].push_back(msg);
+            if(w.outbox[to].size() >= batch_size) flush(from,to);
+        }
+
+        void flush(std::size_t from, std::size_t to) {
+            auto& out = workers[from].outbox[to];
+            if(out.empty()) return;
+            auto& w = workers[to];
+            {
+                std::lock_guard lock(w.m);
+                w.inbox.insert(w.inbox.end(),out.begin(),out.end());
+                w.cv.notify_one();
+            }
+            out.clear();
+        }
+
+        void expand(std::size_t t, Message msg) {
+            auto keys = StateCodec::keys(msg.state);
+            for(int r = 0; r < codec.robots; ++r) {
+                auto& from = paths[codec.position(msg.state,r)];
+                for(int key = 0; key < m.num_keys; ++key) {
+                    if(keys >> key & 1) continue;
+                    if(auto p = from.toKey[key].shortest(keys)) {
+                        ++pending;
+                        send(t,{codec.move(msg.state,r,key),std::uint32_t(msg.length + p->length)});
+                    }
+                }
+            }
+        }
+
+        void work(std::size_t t) {
+            auto& w = workers[t];
+            w.outbox.resize(workers.size());
+            std::vector<Message> received;
+            while(not finished) {
+                {
+                    std::unique_lock lock(w.m);
+                    if(w.open.empty()) w.cv.wait(lock,[&] {return finished or not w.inbox.empty();});
+                    std::swap(received,w.inbox);
+                }
+                for(auto msg : received) w.insert(*this,msg.state,msg.length);
+                received.clear();
+
+                //A batch of the best local states between looks at the inbox
+                for(std::size_t i = 0; i < batch_size and not w.open.empty(); ++i) {
+                    auto [f,msg] = w.open.pop();
+                    if(w.table.get(msg.state) < msg.length or f >= best) {
+                        done_with_state();
+                        continue;
+                    }
+                    ++w.expanded;
+                    expand(t,msg);
+                    done_with_state();
+                }
+                for(std::size_t to = 0; to < workers.size(); ++to) flush(t,to);
+            }
+        }
+};
 
 auto solve(const CompressedMaze& m) {
-    auto paths = precompute_paths(m);
-    
-    return find_all_keys(m,paths);
+    return KeySearch(m).run();
 }
 
 void printResult(SearchResult r) {
@@ -1,142 +1,181 @@
 #include <vector>
-#include <tuple>
 #include <iostream>
-#include <deque>
-#include <map>
-#include <unordered_map>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <string>
 #include <cstdint>
-#include <complex>
-
-namespace IntCode {
-    struct Storage {
-        std::vector<std::int64_t> main;
-        std::map<std::int64_t,std::int64_t> extra{};
-        std::int64_t& operator[](std::size_t loc) {
-            return loc < main.size() ? main[loc] : extra[loc];
+#include "intcode.h"
+#include "thread_pool.h"
+
+/*
+    Answers questions about the tractor beam with as few drone launches as possible.
+    Each thread keeps one VM and resets it from the program between probes, which only copies back the pages the last probe wrote to.
+    Past the first few rows every row of the beam is a single run [lo,hi), and both edges only move right going down.
+    Consecutive rows are followed with a couple of probes per row from the previous edges, a row on its own is found from the slopes of the
+    furthest row seen so far: probe the expected centre, then gallop outwards to each edge and binary search the last step.
+*/
+class Beam {
+    public:
+        //Near the emitter a row can miss the beam entirely, that row is empty
+        struct Row {
+            std::int64_t lo = 0, hi = 0;
+
+            bool empty() const {
+                return hi <= lo;
+            }
+        };
+
+        Beam(const IntCode::Storage& program, ThreadPool& pool) : base(program), pool(pool) {}
+
+        bool probe(std::int64_t x, std::int64_t y) {
+            if(x < 0 or y < 0) return false;
+            thread_local IntCode::Program vm{IntCode::Storage()};
+            vm.reset(base);
+            vm.input.push(x);
+            vm.input.push(y);
+            vm.run();
+            launches.fetch_add(1,std::memory_order_relaxed);
+            return vm.output.pop();
         }
-    };
-
-    struct ins {
-        std::int64_t op;
-        std::array<std::int64_t,3> modes;
-    };
-
-    ins decode(std::int64_t instruction) {
-        return {instruction % 100, {instruction / 100 % 10, instruction / 1000 % 10, instruction / 10000 % 10}};
-    }
-
-    class Program {
-        public:
-            Program(Storage s) : prog(s) {};
-            struct RunResult {
-                std::vector<std::int64_t> output;
-                bool input_requested;
-            };
-            RunResult run(std::deque<std::int64_t> input) {
-                std::array sizes = {0,4,4,2,2,3,3,4,4,2};
-                std::vector<std::int64_t> output;
-                while(prog[loc] != 99) {
-                    auto [op,modes] = decode(prog[loc]);
-                    auto fetch = [&,modes=modes](std::int64_t num) -> std::int64_t& {
-                        auto& address = prog[loc+num];
-                        switch(modes[num-1]) {
-                            case 0:
-                                return prog[address];
-                            case 1:
-                                return address;
-                            case 2:
-                                return prog[address+relative_base];
-                        }
-                        return modes[num-1] ? prog[loc+num] : prog[prog[loc + num]];
-                    };
-                    switch(op) {
-                        case 1:
-                            fetch(3) = fetch(1) + fetch(2);
-                            break;
-                        case 2:
-                            fetch(3) = fetch(1) * fetch(2);
-                            break;
-                        case 3:
-                            if(input.empty()) return {output,true};
-                            fetch(1) = input.front();
-                            input.pop_front();
-                            break;
-                        case 4:
-                            output.push_back(fetch(1));
-                            break;
-                        case 5:
-                            if(fetch(1)) loc = fetch(2) - 3;
-                            break;
-                        case 6:
-                            if(not fetch(1)) loc = fetch(2) - 3;
-                            break;
-                        case 7:
-                            fetch(3) = fetch(1) < fetch(2);
-                            break;
-                        case 8:
-                            fetch(3) = fetch(1) == fetch(2);
-                            break;
-                        case 9:
-                            relative_base += fetch(1);
-                            break;
-                    }
-                    loc += sizes[op];
+
+        std::uint64_t probes() const {
+            return launches;
+        }
+
+        //Points pulled in the width*height area closest to the emitter, one row per task. A row is only probed until it leaves the beam
+        std::int64_t count(std::int64_t width, std::int64_t height) {
+            std::vector<std::int64_t> rows(height);
+            pool.for_each(height,[&](std::size_t y) {
+                std::int64_t x = 0;
+                while(x < width and not probe(x,y)) ++x;
+                auto first = x;
+                while(x < width and probe(x,y)) ++x;
+                rows[y] = x - first;
+                if(x - first > 1) record(y,{first,x});
+            });
+            std::int64_t total = 0;
+            for(auto r : rows) total += r;
+            return total;
+        }
+
+        //The next row down, starting both edges from the ones of the row above.
+        //An edge moves right by about its slope per row, if the beam isn't found within a few steps of that the row is located from scratch
+        Row next(Row above, std::int64_t y) {
+            if(above.empty() or y == 0) return row(y);
+            auto limit = above.hi + above.hi / y + 2;
+            Row r{above.lo,0};
+            while(r.lo < limit and not probe(r.lo,y)) ++r.lo;
+            if(r.lo == limit) return row(y);
+            r.hi = std::max(above.hi,r.lo+1);
+            while(probe(r.hi,y)) ++r.hi;
+            return r;
+        }
+
+        Row row(std::int64_t y) {
+            auto [lo_slope,hi_slope] = slopes();
+            std::int64_t centre = (lo_slope + hi_slope) / 2 * y;
+            //Only when the slopes are still rough: try either side of the estimate, closest first.
+            //Past reach(well beyond both slopes) on the right and 0 on the left there is no beam left to find
+            auto reach = std::max<std::int64_t>(4*(y+1),2*hi_slope*y + 2);
+            centre = std::min(centre,reach-1);
+            for(std::int64_t d = 1; not probe(centre,y); d = d > 0 ? -d-1 : 1-d) {
+                if(centre < 0 and centre + d >= reach) return {};
+                centre += d;
+            }
+
+            auto edge = [&](std::int64_t step) {
+                std::int64_t inside = centre, d = 1;
+                while(probe(inside + step*d,y)) {
+                    inside += step*d;
+                    d *= 2;
                 }
-                return {output,false};
+                //inside is in the beam, inside + step*d isn't
+                while(d > 1) {
+                    d /= 2;
+                    if(probe(inside + step*d,y)) inside += step*d;
+                }
+                return inside;
+            };
+            return {edge(-1),edge(1)+1};
+        }
+
+        //Top left corner of the first size*size square that fits in the beam, closest to the emitter
+        std::pair<std::int64_t,std::int64_t> fit(std::int64_t size) {
+            auto holds = [&](Row top, Row bottom) {
+                return not top.empty() and not bottom.empty() and bottom.lo + size <= top.hi;
+            };
+            auto fits = [&](std::int64_t top) {
+                Row rows[2];
+                pool.for_each(2,[&](std::size_t i) {rows[i] = row(top + i*(size-1));});
+                if(rows[1].hi - rows[1].lo > 1) record(top+size-1,rows[1]);
+                return holds(rows[0],rows[1]);
+            };
+
+            //Gallop from just above the first row, the only row known not to fit without looking
+            std::int64_t bad = -1, step = 1;
+            while(not fits(bad + step)) {
+                bad += step;
+                step *= 2;
             }
-        private:
-            Storage prog;
-            std::size_t loc = 0;
-            std::int64_t relative_base = 0;
-    };
-
-    template<typename InputFunc, typename OutputFunc>
-    void run(Storage prog, InputFunc&& input, OutputFunc&& out) {
-        Program p(std::move(prog));
-        Program::RunResult res = p.run({});
-        for(auto o : res.output) out(o);
-        while(res.input_requested) {
-            res = p.run({input()});
-            for(auto o : res.output) out(o);
+            std::int64_t good = bad + step;
+            while(good - bad > 1) {
+                auto mid = bad + (good - bad) / 2;
+                if(fits(mid)) good = mid;
+                else bad = mid;
+            }
+
+            //Rounding makes the edges step a little unevenly, so the test isn't strictly monotone near the answer.
+            //Follow the rows above it both at the top and the bottom edge of the square to make sure none of them fits already
+            std::int64_t first = std::max<std::int64_t>(0,good - window);
+            std::vector<Row> tops(good - first + 1), bottoms(good - first + 1);
+            pool.for_each(2,[&](std::size_t i) {
+                auto& rows = i ? bottoms : tops;
+                auto offset = std::int64_t(i)*(size-1);
+                rows[0] = row(first + offset);
+                for(std::size_t r = 1; r < rows.size(); ++r) rows[r] = next(rows[r-1],first + offset + r);
+            });
+            for(std::size_t r = 0; r < tops.size(); ++r) {
+                if(holds(tops[r],bottoms[r])) return {bottoms[r].lo,first + std::int64_t(r)};
+            }
+            return {bottoms.back().lo,good};
         }
-    }
-
-    template<int N, typename F>
-    auto output_every(F output) {
-        return [output, a = std::array<std::int64_t,N>{},current=0](std::int64_t in) mutable {
-            a[current++] = in;
-            if(current == N) {
-                std::apply(output,a);
-                current = 0;
+
+    private:
+        static constexpr std::int64_t window = 16;
+
+        IntCode::Program base;
+        ThreadPool& pool;
+        std::atomic<std::uint64_t> launches = 0;
+        std::mutex m;
+        std::int64_t furthest = 0;
+        Row reference;
+
+        //Keeps the furthest row seen as the reference for the slopes
+        void record(std::int64_t y, Row r) {
+            std::lock_guard lock(m);
+            if(y > furthest) {
+                furthest = y;
+                reference = r;
             }
-        };
-    }
-}
+        }
 
-int main() {
-    IntCode::Storage program = {{109,424,203,1,21102,11,1,0,1106,0,282,21102,18,1,0,1106,0,259,2102,1,1,221,203,1,21102,1,31,0,1106,0,282,21101,0,38,0,1106,0,259,21001,23,0,2,22101,0,1,3,21101,1,0,1,21102,57,1,0,1106,0,303,2101,0,1,222,21002,221,1,3,20102,1,221,2,21101,259,0,1,21101,0,80,0,1105,1,225,21102,1,83,2,21101,0,91,0,1105,1,303,1202,1,1,223,20102,1,222,4,21101,259,0,3,21101,225,0,2,21102,1,225,1,21101,118,0,0,1106,0,225,21002,222,1,3,21101,179,0,2,21102,1,133,0,1105,1,303,21202,1,-1,1,22001,223,1,1,21101,0,148,0,1105,1,259,1202,1,1,223,21001,221,0,4,20101,0,222,3,21102,1,19,2,1001,132,-2,224,1002,224,2,224,1001,224,3,224,1002,132,-1,132,1,224,132,224,21001,224,1,1,21102,1,195,0,105,1,109,20207,1,223,2,21002,23,1,1,21102,-1,1,3,21102,214,1,0,1106,0,303,22101,1,1,1,204,1,99,0,0,0,0,109,5,2101,0,-4,249,21201,-3,0,1,21202,-2,1,2,22101,0,-1,3,21101,0,250,0,1106,0,225,22101,0,1,-4,109,-5,2106,0,0,109,3,22107,0,-2,-1,21202,-1,2,-1,21201,-1,-1,-1,22202,-1,-2,-2,109,-3,2106,0,0,109,3,21207,-2,0,-1,1206,-1,294,104,0,99,21202,-2,1,-2,109,-3,2105,1,0,109,5,22207,-3,-4,-1,1206,-1,346,22201,-4,-3,-4,21202,-3,-1,-1,22201,-4,-1,2,21202,2,-1,-1,22201,-4,-1,1,21201,-2,0,3,21101,343,0,0,1105,1,303,1106,0,415,22207,-2,-3,-1,1206,-1,387,22201,-3,-2,-3,21202,-2,-1,-1,22201,-3,-1,3,21202,3,-1,-1,22201,-3,-1,2,21201,-4,0,1,21101,384,0,0,1106,0,303,1105,1,415,21202,-4,-1,-4,22201,-4,-3,-4,22202,-3,-2,-2,22202,-2,-4,-4,22202,-3,-2,-3,21202,-4,-1,-2,22201,-3,-2,1,21202,1,1,-4,109,-5,2105,1,0}};
-    auto get = [&](int x, int y) {
-        IntCode::Program p{program};
-        auto result = p.run({x,y});
-        return result.output[0];
-    };
-    int total = 0;
-    std::array<std::array<char,50>,50> grid;
-    for(int x = 0; x < 50; ++x) {
-        for(int y = 0; y < 50; ++y) {
-            total += get(x,y);
-            grid[y][x] = get(x,y) ? '#' : '.';
+        std::pair<double,double> slopes() {
+            std::lock_guard lock(m);
+            if(furthest == 0) return {0.5,1.5};
+            return {double(reference.lo) / furthest,double(reference.hi - 1) / furthest};
         }
-    }
-    std::cout << "Part 1: " << total << '\n';
-
-    //somewhat arbitrary starting points chosen, but skips the weirdness at the start
-    int x = 50;
-    int y = 200;
-    auto size = 100;
-    do {
-        ++y;
-        while(not get(x,y)) ++x;
-    } while(not get(x+size-1,y-(size-1)));
-    std::cout << "Part 2: " << x*10000 + y-(size-1);
+};
+
+int main(int argc, char** argv) {
+    IntCode::Storage program = {{109,424,203,1,21102,11,1,0,1106,0,282,21102,18,1,0,1106,0,259,2102,1,1,221,203,1,21102,1,31,0,1106,0,282,21101,0,38,0,1106,0,259,21001,23,0,2,22101,0,1,3,21101,1,0,1,21102,57,1,0,1106,0,303,2101,0,1,222,21002,221,1,3,20102,1,221,2,21101,259,0,1,21101,0,80,0,1105,1,225,21102,1,83,2,21101,0,91,0,1105,1,303,1202,1,1,223,20102,1,222,4,21101,259,0,3,21101,225,0,2,21102,1,225,1,21101,118,0,0,1106,0,225,21002,222,1,3,21101,179,0,2,21102,1,133,0,1105,1,303,21202,1,-1,1,22001,223,1,1,21101,0,148,0,1105,1,259,1202,1,1,223,21001,221,0,4,20101,0,222,3,21102,1,19,2,1001,132,-2,224,1002,224,2,224,1001,224,3,224,1002,132,-1,132,1,224,132,224,21001,224,1,1,21102,1,195,0,105,1,109,20207,1,223,2,21002,23,1,1,21102,-1,1,3,21102,214,1,0,1106,0,303,22101,1,1,1,204,1,99,0,0,0,0,109,5,2101,0,-4,249,21201,-3,0,1,21202,-2,1,2,22101,0,-1,3,21101,0,250,0,1106,0,225,22101,0,1,-4,109,-5,2106,0,0,109,3,22107,0,-2,-1,21202,-1,2,-1,21201,-1,-1,-1,22202,-1,-2,-2,109,-3,2106,0,0,109,3,21207,-2,0,-1,1206,-1,294,104,0,99,21202,-2,1,-2,109,-3,2105,1,0,109,5,22207,-3,-4,-1,1206,-1,346,22201,-4,-3,-4,21202,-3,-1,-1,22201,-4,-1,2,21202,2,-1,-1,22201,-4,-1,1,21201,-2,0,3,21101,343,0,0,1105,1,303,1106,0,415,22207,-2,-3,-1,1206,-1,387,22201,-3,-2,-3,21202,-2,-1,-1,22201,-3,-1,3,21202,3,-1,-1,22201,-3,-1,2,21201,-4,0,1,21101,384,0,0,1106,0,303,1105,1,415,21202,-4,-1,-4,22201,-4,-3,-4,22202,-3,-2,-2,22202,-2,-4,-4,22202,-3,-2,-3,21202,-4,-1,-2,22201,-3,-2,1,21202,1,1,-4,109,-5,2105,1,0}};
+    ThreadPool pool;
+    Beam beam(program,pool);
+    std::cout << "Part 1: " << beam.count(50,50) << '\n';
+
+    std::int64_t size = argc > 1 ? std::stoll(argv[1]) : 100;
+    auto [x,y] = beam.fit(size);
+    std::cout << "Part 2: " << x*10000 + y << '\n';
+    std::cout << beam.probes() << " probes\n";
 }
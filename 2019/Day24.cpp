@@ -1,97 +1,151 @@
 #include <iostream>
-#include <string_view>
-#include <bitset>
-#include <deque>
+#include <string>
+#include <vector>
 #include <unordered_set>
 #include <algorithm>
 #include <numeric>
+#include <bit>
+#include <cstdint>
+#include "thread_pool.h"
 
-auto next(std::bitset<25> field) {
-    auto next = field;
-    int current = 0;
-    for(int y = 0; y < 5; ++y) {
-        for(int x = 0; x < 5; ++x) {
-            int num = (x > 0 and field.test(current-1)) + (x < 4 and field.test(current+1))
-                    + (y > 0 and field.test(current-5)) + (y < 4 and field.test(current+5));
-            if(field.test(current) and num != 1) next.reset(current);
-            else if(not field.test(current) and (num == 1 or num == 2)) next.set(current);
-            ++current;
+//A level is a 25 bit word, bit 5*y+x being the tile at (x,y)
+namespace Eris {
+    constexpr std::uint32_t all = (1u << 25) - 1;
+    constexpr std::uint32_t centre = 1u << 12;
+    constexpr std::uint32_t row0 = 0x1F, row4 = row0 << 20;
+    constexpr std::uint32_t col0 = 0x108421, col4 = col0 << 4;
+    //The tiles around the centre: above, left, right and below
+    constexpr int above = 7, left = 11, right = 13, below = 17;
+
+    //Per tile neighbour count as bit slices, saturating at 4. Only whether a count is exactly 1 or 2 matters
+    struct Counter {
+        std::uint32_t ones = 0, twos = 0, more = 0;
+
+        void add(std::uint32_t m) {
+            auto carry = ones & m;
+            ones ^= m;
+            more |= twos & carry;
+            twos ^= carry;
+        }
+    };
+
+    //Moves bit from of w to bit to
+    template<int from, int to>
+    constexpr std::uint32_t move(std::uint32_t w) {
+        if constexpr(from < to) return (w << (to - from)) & (1u << to);
+        else return (w >> (from - to)) & (1u << to);
+    }
+
+    //Bit k of each inner edge, moved onto the tile of this level that borders it
+    template<int k>
+    constexpr std::uint32_t inner_edges(std::uint32_t inner) {
+        return move<k,above>(inner) | move<20+k,below>(inner) | move<5*k,left>(inner) | move<5*k+4,right>(inner);
+    }
+
+    //All neighbour counts at once from shifted copies of the level, plus the bordering tiles of the levels outside and inside when Recursive
+    template<bool Recursive>
+    constexpr std::uint32_t evolve(std::uint32_t outer, std::uint32_t field, std::uint32_t inner) {
+        Counter c;
+        c.add((field << 1) & ~col0);
+        c.add((field >> 1) & ~col4);
+        c.add((field << 5) & all);
+        c.add(field >> 5);
+        if constexpr(Recursive) {
+            auto bit = [&](int b) {return 0u - ((outer >> b) & 1);};
+            c.add((row0 & bit(above)) | (row4 & bit(below)));
+            c.add((col0 & bit(left)) | (col4 & bit(right)));
+            c.add(inner_edges<0>(inner));
+            c.add(inner_edges<1>(inner));
+            c.add(inner_edges<2>(inner));
+            c.add(inner_edges<3>(inner));
+            c.add(inner_edges<4>(inner));
         }
+        auto one = c.ones & ~c.twos & ~c.more;
+        auto two = ~c.ones & c.twos & ~c.more;
+        auto next = (one | (~field & two)) & all;
+        return Recursive ? next & ~centre : next;
     }
-    return next;
 }
 
-auto next(std::deque<std::bitset<25>> field) {
-    field.push_front({});
-    field.push_back({});
-    auto next = field;
-    auto neighbors = [&](int level, int x, int y) -> int {
-        int num = 0;
-        if(level < field.size() - 1) {
-            if(x == 0) {
-                num += field[level+1].test(2*5+1);
-            } else if(x == 4) {
-                num += field[level+1].test(2*5+3);
-            }
-            if(y == 0) {
-                num += field[level+1].test(1*5+2);
-            } else if(y == 4) {
-                num += field[level+1].test(3*5+2);
-            }
+/*
+    Levels from the outermost inwards in a flat array with free space on both sides, and a second one of the same shape the next minute is written to.
+    Each minute evolves the live levels plus one new level on either side, then trims empty levels off the ends again,
+    so the array only has to move(to the middle of one twice as large) when the bugs have spread up to one of its ends.
+    Every level only reads its neighbours from the previous minute, so a minute is one branch free pass the compiler can vectorise,
+    split over the pool once there are enough levels. With vectorisation(-O3) a level costs about 2ns a minute on one core,
+    which brings 10^6 minutes(growing to as many levels) within reach.
+*/
+class RecursiveEris {
+    public:
+        RecursiveEris(std::uint32_t start, ThreadPool& pool) : levels(capacity), next(capacity), pool(pool) {
+            first = capacity/2;
+            last = first+1;
+            levels[first] = start;
         }
-        if(level > 0) {
-            if(x == 2 and y == 1) {
-                for(int x1 = 0; x1 < 5; ++x1) {
-                    num += field[level-1].test(x1);
-                }
-            } else if(x == 2 and y == 3) {
-                for(int x1 = 0; x1 < 5; ++x1) {
-                    num += field[level-1].test(x1+4*5);
-                }
-            } else if(x == 1 and y == 2) {
-                for(int y1 = 0; y1 < 5; ++y1) {
-                    num += field[level-1].test(y1*5+0);
-                }
-            } else if(x == 3 and y == 2) {
-                for(int y1 = 0; y1 < 5; ++y1) {
-                    num += field[level-1].test(y1*5+4);
-                }
-            }
+
+        void run(std::uint64_t minutes) {
+            for(std::uint64_t m = 0; m < minutes; ++m) minute();
         }
-        auto& f = field[level];
-        auto current = x+y*5;
-        num += (x > 0 and f.test(current-1)) + (x < 4 and f.test(current+1))
-             + (y > 0 and f.test(current-5)) + (y < 4 and f.test(current+5));
-        return num;
-    };
-    for(int level = 0; level < field.size(); ++level) {
-        for(int current = 0; current < 25; ++current) {
-            if(current == 2*5+2) continue;
-            auto num = neighbors(level,current%5,current/5);
-            if(field[level].test(current) and num != 1) next[level].reset(current);
-            else if(not field[level].test(current) and (num == 1 or num == 2)) next[level].set(current);
+
+        std::uint64_t bugs() const {
+            return std::accumulate(levels.begin()+first,levels.begin()+last,std::uint64_t(0),[](auto acc, auto l) {return acc + std::popcount(l);});
         }
-    }
-    while(next.front().count() == 0) next.pop_front();
-    while(next.back().count() == 0) next.pop_back();
-    return next;
-}
 
-void print(std::deque<std::bitset<25>> in) {
-    for(int y = 0; y < 5; y++) {
-        for(auto& level : in) {
-            for(int x = 0; x < 5; ++x) {
-                if(x == 2 and y == 2) std::cout << '?';
-                else std::cout << (level.test(y*5+x) ? '#' : '.');
+        std::size_t depth() const {
+            return last - first;
+        }
+
+    private:
+        static constexpr std::size_t capacity = 1 << 10, chunk = 1 << 15;
+
+        std::vector<std::uint32_t> levels, next;
+        std::size_t first, last;
+        //Where next still holds levels from two minutes ago
+        std::size_t stale_first = 0, stale_last = 0;
+        ThreadPool& pool;
+
+        //Keeps an empty level at either side of the levels about to be written
+        void make_room() {
+            if(first >= 2 and last + 2 <= levels.size()) return;
+            std::size_t size = std::max(levels.size(),4*depth());
+            std::vector<std::uint32_t> moved(size);
+            auto start = (size - depth()) / 2;
+            std::copy(levels.begin()+first,levels.begin()+last,moved.begin()+start);
+            levels = std::move(moved);
+            next.assign(size,0);
+            last = start + depth();
+            first = start;
+            stale_first = stale_last = 0;
+        }
+
+        void minute() {
+            make_room();
+            auto begin = first-1, end = last+1;
+            std::fill(next.begin()+stale_first,next.begin()+std::clamp(begin,stale_first,stale_last),0);
+            std::fill(next.begin()+std::clamp(end,stale_first,stale_last),next.begin()+stale_last,0);
+
+            auto evolve = [&](std::size_t from, std::size_t to) {
+                for(auto i = from; i < to; ++i) next[i] = Eris::evolve<true>(levels[i-1],levels[i],levels[i+1]);
+            };
+            if(end - begin < 2*chunk) {
+                evolve(begin,end);
+            } else {
+                pool.for_each((end - begin + chunk - 1) / chunk,[&](std::size_t c) {
+                    evolve(begin + c*chunk,std::min(end,begin + (c+1)*chunk));
+                });
             }
-            std::cout << ' ';
+
+            std::swap(levels,next);
+            stale_first = first;
+            stale_last = last;
+            first = begin;
+            last = end;
+            while(last - first > 1 and levels[first] == 0) ++first;
+            while(last - first > 1 and levels[last-1] == 0) --last;
         }
-        std::cout << '\n';
-    }
-    std::cout << '\n';
-}
+};
 
-std::string input = 
+std::string input =
 R"(
 ###..
 .##..
@@ -99,19 +153,20 @@ R"(
 ##..#
 .###.)";
 
-int main() {
+int main(int argc, char** argv) {
     std::erase(input,'\n');
-    std::reverse(input.begin(),input.end());
-    std::bitset<25> field(input,0,25,'.','#');
-    auto field_copy = field;
-    std::unordered_set<decltype(field.to_ulong())> seen;
-    while(seen.insert(field.to_ulong()).second) {
-        field = next(field);
-    }
-    std::cout << "Part 1: " << field.to_ulong() << '\n';
-    std::deque fields{field_copy};
-    for(int i = 0; i < 200; ++i) {
-        fields = next(fields);
-    }
-    std::cout << "Part 2: " << std::accumulate(fields.begin(),fields.end(),0,[](int a, auto&& b) {return a+b.count();}) << '\n';
+    std::uint32_t field = 0;
+    for(std::size_t i = 0; i < input.size(); ++i) field |= std::uint32_t(input[i] == '#') << i;
+
+    auto flat = field;
+    std::unordered_set<std::uint32_t> seen;
+    while(seen.insert(flat).second) flat = Eris::evolve<false>(0,flat,0);
+    std::cout << "Part 1: " << flat << '\n';
+
+    //Optionally the number of minutes to evolve the recursive grid for
+    std::uint64_t minutes = argc > 1 ? std::stoull(argv[1]) : 200;
+    ThreadPool pool;
+    RecursiveEris eris(field,pool);
+    eris.run(minutes);
+    std::cout << "Part 2: " << eris.bugs() << '\n';
 }
@@ -0,0 +1,372 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+#include <array>
+#include <tuple>
+#include <utility>
+#include <cstdint>
+
+//Shared Intcode VM for the 2019 days
+namespace IntCode {
+    /*
+        Memory is a table of 512 word pages shared between copies, so copying a Storage(and with it a Program) only copies the table.
+        A page is cloned on the first write through a copy that doesn't hold it alone, owned marks the pages already known to be private so
+        every later write is a plain store. Missing pages read as zero and are only allocated when written.
+        Copying clears owned on both sides, it is mutable since a copy of a const Storage still has to give up its claims.
+        Forks of one Program may be taken concurrently, as long as that Program isn't running at the same time.
+    */
+    class Storage {
+        public:
+            static constexpr std::size_t page_bits = 9;
+            static constexpr std::size_t page_size = std::size_t(1) << page_bits;
+
+            Storage() = default;
+            Storage(const std::vector<std::int64_t>& program) : image(program.size()) {
+                pages.resize((program.size() + page_size - 1) / page_size);
+                owned.resize(pages.size());
+                for(std::size_t p = 0; p < pages.size(); ++p) {
+                    pages[p] = std::make_shared<Page>();
+                    auto first = program.begin() + p*page_size;
+                    std::copy(first,first + std::min(page_size,program.size() - p*page_size),pages[p]->words.begin());
+                }
+            }
+
+            Storage(const Storage& o) : pages(o.pages), owned(o.pages.size()), basis(), image(o.image) {
+                o.release();
+            }
+
+            Storage& operator=(const Storage& o) {
+                if(this != &o) {
+                    pages = o.pages;
+                    owned.assign(pages.size(),0);
+                    basis.clear();
+                    image = o.image;
+                    o.release();
+                }
+                return *this;
+            }
+
+            Storage(Storage&&) = default;
+            Storage& operator=(Storage&&) = default;
+
+            /*
+                Turns this into a copy of o without giving up its own memory: a page this holds alone is overwritten instead of swapped for a shared one.
+                Such a page remembers the page it was copied from(basis, which also keeps that one from changing) and is left unowned,
+                so the first write after the reset sets its owned flag again. A private page still unowned and copied from the same page is left alone,
+                which makes resetting over and over from one program cost only the pages that were written in between.
+            */
+            void reset(const Storage& o) {
+                if(this == &o) return;
+                pages.resize(o.pages.size());
+                owned.resize(o.pages.size());
+                basis.resize(o.pages.size());
+                for(std::size_t p = 0; p < pages.size(); ++p) {
+                    auto& src = o.pages[p];
+                    if(pages[p] and pages[p] != src and pages[p].use_count() == 1) {
+                        if(not flag(p).load(std::memory_order_relaxed) and basis[p] == src) continue;
+                        std::atomic_thread_fence(std::memory_order_acquire);
+                        if(src) pages[p]->words = src->words;
+                        else pages[p]->words.fill(0);
+                        basis[p] = src;
+                    } else {
+                        pages[p] = src;
+                        basis[p] = nullptr;
+                    }
+                    flag(p).store(0,std::memory_order_relaxed);
+                }
+                image = o.image;
+                o.release();
+            }
+
+            std::int64_t read(std::size_t loc) const {
+                auto p = loc >> page_bits;
+                return p < pages.size() and pages[p] ? pages[p]->words[loc & (page_size-1)] : 0;
+            }
+
+            std::int64_t& write(std::size_t loc) {
+                auto p = loc >> page_bits;
+                if(p < owned.size() and flag(p).load(std::memory_order_relaxed)) return pages[p]->words[loc & (page_size-1)];
+                return claim(p).words[loc & (page_size-1)];
+            }
+
+            std::int64_t& operator[](std::size_t loc) {
+                return write(loc);
+            }
+
+            //Length of the program the storage was built from
+            std::size_t image_size() const {
+                return image;
+            }
+
+        private:
+            struct Page {
+                std::array<std::int64_t,page_size> words{};
+            };
+
+            std::vector<std::shared_ptr<Page>> pages;
+            mutable std::vector<std::uint8_t> owned;
+            std::vector<std::shared_ptr<Page>> basis;
+            std::size_t image = 0;
+
+            //Several threads may fork the same Program at once, so the flags are only touched through relaxed atomic accesses
+            std::atomic_ref<std::uint8_t> flag(std::size_t p) const {
+                return std::atomic_ref<std::uint8_t>(owned[p]);
+            }
+
+            void release() const {
+                for(std::size_t p = 0; p < owned.size(); ++p) {
+                    if(flag(p).load(std::memory_order_relaxed)) flag(p).store(0,std::memory_order_relaxed);
+                }
+            }
+
+            Page& claim(std::size_t p) {
+                if(p >= pages.size()) {
+                    pages.resize(p+1);
+                    owned.resize(p+1);
+                }
+                if(not pages[p]) {
+                    pages[p] = std::make_shared<Page>();
+                } else if(pages[p].use_count() != 1) {
+                    pages[p] = std::make_shared<Page>(*pages[p]);
+                } else {
+                    //Pairs with the release of the last other holder, whose reads must not see this write
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                }
+                flag(p).store(1,std::memory_order_relaxed);
+                return *pages[p];
+            }
+    };
+
+    //Power of two ring buffer that doubles when full. The VM reads and writes it in place, so resuming never copies the queued values
+    class Ring {
+        public:
+            void push(std::int64_t v) {
+                if(tail - head == data.size()) grow();
+                data[tail++ & (data.size()-1)] = v;
+            }
+
+            std::int64_t pop() {
+                return data[head++ & (data.size()-1)];
+            }
+
+            std::int64_t front() const {
+                return data[head & (data.size()-1)];
+            }
+
+            bool empty() const {
+                return head == tail;
+            }
+
+            std::size_t size() const {
+                return tail - head;
+            }
+
+            void clear() {
+                head = tail = 0;
+            }
+
+        private:
+            std::vector<std::int64_t> data = std::vector<std::int64_t>(16);
+            std::size_t head = 0, tail = 0;
+
+            void grow() {
+                std::vector<std::int64_t> bigger(2*data.size());
+                for(std::size_t i = head; i < tail; ++i) bigger[i-head] = data[i & (data.size()-1)];
+                tail -= head;
+                head = 0;
+                data = std::move(bigger);
+            }
+    };
+
+    enum class Status {Running, NeedInput, Output, Halted};
+
+    /*
+        Instructions are decoded once per address into a cache alongside the program image, as a pointer to a handler specialised on the opcode and its modes.
+        Every entry keeps the raw word it was decoded from and is re-decoded when that word no longer matches,
+        so self-modifying writes(or pokes into main before running) invalidate it without any bookkeeping on the write path.
+        Anything executing past the image is decoded on the fly.
+    */
+    class Program {
+        public:
+            Ring input, output;
+
+            Program(Storage s) : prog(std::move(s)), cache(prog.image_size()) {}
+
+            //Copies share every memory page until one side writes to it, so a fork costs a page table and the decode cache
+            Program fork() const {
+                return *this;
+            }
+
+            //Same as assigning a fork of o, but the memory pages and rings this already has are reused.
+            //The decode cache checks every entry against memory anyway, so it is kept as long as it covers the same image
+            void reset(const Program& o) {
+                if(this == &o) return;
+                input = o.input;
+                output = o.output;
+                prog.reset(o.prog);
+                if(cache.size() != o.cache.size()) cache = o.cache;
+                loc = o.loc;
+                relative_base = o.relative_base;
+                executed = o.executed;
+            }
+
+            Storage& memory() {
+                return prog;
+            }
+
+            //Instructions executed so far, including a blocked input that had to be retried
+            std::uint64_t instructions() const {
+                return executed;
+            }
+
+            //Executes a single instruction. An input with nothing queued is not executed and reports NeedInput
+            Status step() {
+                return execute<true,true>();
+            }
+
+            //Runs until the program outputs a value, needs input it doesn't have or halts
+            Status run_until_io() {
+                return execute<false,true>();
+            }
+
+            //Runs until the program halts or needs input it doesn't have, leaving every output in the output ring
+            Status run() {
+                return execute<false,false>();
+            }
+
+        private:
+            using Handler = Status (*)(Program&);
+
+            struct Decoded {
+                std::int64_t raw = -1;
+                Handler handler = &halt;
+            };
+
+            Storage prog;
+            std::vector<Decoded> cache;
+            Decoded scratch;
+            std::size_t loc = 0;
+            std::int64_t relative_base = 0;
+            std::uint64_t executed = 0;
+
+            //Immediate operands are the parameter word itself, the other modes point at memory(offset by the relative base for mode 2)
+            template<int Mode>
+            std::size_t address(int num) const {
+                if constexpr(Mode == 1) return loc+num;
+                else if constexpr(Mode == 2) return prog.read(loc+num) + relative_base;
+                else return prog.read(loc+num);
+            }
+
+            template<int Mode>
+            std::int64_t value(int num) const {
+                if constexpr(Mode == 1) return prog.read(loc+num);
+                else return prog.read(address<Mode>(num));
+            }
+
+            template<int Mode>
+            std::int64_t& target(int num) {
+                return prog.write(address<Mode>(num));
+            }
+
+            static Status halt(Program&) {
+                return Status::Halted;
+            }
+
+            //One handler per opcode and mode combination, so executing an instruction never looks at its modes again
+            template<int Op, int M1, int M2, int M3>
+            static Status handle(Program& p) {
+                if constexpr(Op == 1) {
+                    p.target<M3>(3) = p.value<M1>(1) + p.value<M2>(2);
+                } else if constexpr(Op == 2) {
+                    p.target<M3>(3) = p.value<M1>(1) * p.value<M2>(2);
+                } else if constexpr(Op == 3) {
+                    if(p.input.empty()) return Status::NeedInput;
+                    p.target<M1>(1) = p.input.pop();
+                } else if constexpr(Op == 4) {
+                    p.output.push(p.value<M1>(1));
+                    p.loc += 2;
+                    return Status::Output;
+                } else if constexpr(Op == 5 or Op == 6) {
+                    if((p.value<M1>(1) != 0) == (Op == 5)) {
+                        p.loc = p.value<M2>(2);
+                        return Status::Running;
+                    }
+                } else if constexpr(Op == 7) {
+                    p.target<M3>(3) = p.value<M1>(1) < p.value<M2>(2);
+                } else if constexpr(Op == 8) {
+                    p.target<M3>(3) = p.value<M1>(1) == p.value<M2>(2);
+                } else if constexpr(Op == 9) {
+                    p.relative_base += p.value<M1>(1);
+                } else {
+                    return Status::Halted;
+                }
+                static constexpr std::array<std::size_t,10> sizes = {0,4,4,2,2,3,3,4,4,2};
+                p.loc += sizes[Op];
+                return Status::Running;
+            }
+
+            //Indexed by op + 10*(m1 + 3*m2 + 9*m3)
+            static constexpr auto handlers = []<std::size_t... I>(std::index_sequence<I...>) {
+                return std::array<Handler,sizeof...(I)>{&handle<I%10,I/10%3,I/30%3,I/90%3>...};
+            }(std::make_index_sequence<270>{});
+
+            static Decoded decode(std::int64_t instruction) {
+                auto op = instruction % 100;
+                auto m1 = instruction / 100 % 10, m2 = instruction / 1000 % 10, m3 = instruction / 10000 % 10;
+                if(op < 1 or op > 9 or m1 > 2 or m2 > 2 or m3 > 2 or instruction >= 100000) return {instruction,&halt};
+                return {instruction,handlers[op + 10*(m1 + 3*m2 + 9*m3)]};
+            }
+
+            const Decoded& fetch() {
+                auto raw = prog.read(loc);
+                auto& d = loc < cache.size() ? cache[loc] : scratch;
+                if(d.raw != raw) d = decode(raw);
+                return d;
+            }
+
+            /*
+                The interpreter loop behind step, run_until_io and run. Single decides whether to stop after one instruction,
+                and OnOutput whether an output ends the run. Both are template flags so the hot loop carries no extra checks.
+            */
+            template<bool Single, bool OnOutput>
+            Status execute() {
+                while(true) {
+                    auto status = fetch().handler(*this);
+                    ++executed;
+                    if(Single) return status;
+                    if(status == Status::Running or (status == Status::Output and not OnOutput)) continue;
+                    return status;
+                }
+            }
+    };
+
+    template<typename InputFunc, typename OutputFunc>
+    void run(Storage prog, InputFunc&& input, OutputFunc&& out) {
+        Program p(std::move(prog));
+        while(true) {
+            switch(p.run_until_io()) {
+                case Status::NeedInput:
+                    p.input.push(input());
+                    break;
+                case Status::Output:
+                    out(p.output.pop());
+                    break;
+                default:
+                    return;
+            }
+        }
+    }
+
+    template<int N, typename T = std::int64_t, typename F>
+    auto output_every(F output) {
+        return [output, a = std::array<T,N>{},current=0](T in) mutable {
+            a[current++] = in;
+            if(current == N) {
+                std::apply(output,a);
+                current = 0;
+            }
+        };
+    }
+}
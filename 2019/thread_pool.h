@@ -0,0 +1,81 @@
+#pragma once
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <algorithm>
+
+/*
+    Fixed set of worker threads that stay parked between batches, for searches that hand out many small batches(eg. one per BFS level).
+    for_each hands out indices from a shared counter, the calling thread works along and returns once every index is done.
+*/
+class ThreadPool {
+    public:
+        explicit ThreadPool(std::size_t num_threads = std::max(1u,std::thread::hardware_concurrency())) {
+            for(std::size_t t = 1; t < num_threads; ++t) {
+                workers.emplace_back([this] {work();});
+            }
+        }
+
+        ~ThreadPool() {
+            {
+                std::lock_guard lock(m);
+                stopping = true;
+            }
+            work_ready.notify_all();
+            for(auto& t : workers) t.join();
+        }
+
+        std::size_t size() const {
+            return workers.size()+1;
+        }
+
+        //Calls f(i) for every i in [0,n)
+        void for_each(std::size_t n, const std::function<void(std::size_t)>& f) {
+            {
+                std::lock_guard lock(m);
+                job = &f;
+                job_size = n;
+                next = 0;
+                busy = workers.size();
+                ++generation;
+            }
+            work_ready.notify_all();
+            drain();
+            std::unique_lock lock(m);
+            work_done.wait(lock,[this] {return busy == 0;});
+            job = nullptr;
+        }
+
+    private:
+        std::vector<std::thread> workers;
+        std::mutex m;
+        std::condition_variable work_ready, work_done;
+        const std::function<void(std::size_t)>* job = nullptr;
+        std::size_t job_size = 0;
+        std::atomic<std::size_t> next = 0;
+        std::size_t busy = 0;
+        std::size_t generation = 0;
+        bool stopping = false;
+
+        void drain() {
+            for(std::size_t i; (i = next.fetch_add(1)) < job_size;) (*job)(i);
+        }
+
+        void work() {
+            std::size_t seen = 0;
+            while(true) {
+                {
+                    std::unique_lock lock(m);
+                    work_ready.wait(lock,[&] {return stopping or generation != seen;});
+                    if(stopping) return;
+                    seen = generation;
+                }
+                drain();
+                std::lock_guard lock(m);
+                if(--busy == 0) work_done.notify_one();
+            }
+        }
+};